@@ -0,0 +1,74 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "Action.h"
+
+class KKSFieldSplitAction;
+
+template <>
+InputParameters validParams<KKSFieldSplitAction>();
+
+//KKSFieldSplitAction sets up a PETSc fieldsplit preconditioner (FSP) that
+//splits a KKS (+ mechanics) system by physics, in place of a direct solver
+//on the whole Jacobian:
+//
+//  top          multiplicative: kks, then mechanics
+//  kks          multiplicative: diffusion, then phase fields
+//  diffusion    Schur complement of compositions and diffusion potentials
+//
+//The compositions only carry a mass (time derivative) term, so they are
+//eliminated with Jacobi, and the Schur complement on the diffusion
+//potentials is a diffusion operator that AMG solves well. The phase
+//fields use ASM/ILU, the displacements AMG tuned for elasticity.
+//Blocks whose variables are not given are left out of the tree. Every
+//nonlinear variable must be in one of the blocks, and the input must not
+//have a [Preconditioning] block.
+//
+//  [KKSFieldSplit]
+//    diffusion_potentials = 'muB muC'
+//    compositions = 'xB xC'
+//    phase_fields = 'eta1 eta2'
+//    displacements = 'disp_x disp_y'
+//  []
+
+class KKSFieldSplitAction : public Action
+{
+public:
+  KKSFieldSplitAction(InputParameters params);
+
+  virtual void act() override;
+
+protected:
+  //Add a split of the given variables solved with the preconditioner pc
+  void addLeafSplit(const std::string & name,
+                    const std::vector<NonlinearVariableName> & vars,
+                    const std::string & pc);
+
+  //Add a split made of other splits
+  void addParentSplit(const std::string & name,
+                      const std::vector<std::string> & splitting,
+                      const std::string & splitting_type);
+
+  //Add the splits of the tree
+  void buildSplits();
+
+  //Check that the splits hold every nonlinear variable, each once
+  void checkVariables() const;
+
+  //Name of the split at the top of the tree
+  std::string topSplit() const;
+
+  const std::vector<NonlinearVariableName> _diffusion_potentials;
+  const std::vector<NonlinearVariableName> _compositions;
+  const std::vector<NonlinearVariableName> _phase_fields;
+  const std::vector<NonlinearVariableName> _displacements;
+};
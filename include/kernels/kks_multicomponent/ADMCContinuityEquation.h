@@ -0,0 +1,51 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "ADMultiCompMultiPhaseBase.h"
+
+#include <array>
+
+// Forward Declarations
+template <unsigned int C>
+class ADMCContinuityEquationTempl;
+
+/**
+ * AD version of MCContinuityEquationB/C/D: the flux of component C
+ * (0, 1, 2 for B, C, D) of a A-B-C-D alloy, sum_k L_Ck * grad(mu_k), with
+ * the Onsager mobilities interpolated between the phases.
+ * The variable of the kernel is the mole fraction of the component.
+ * The mobilities (L_BB_alpha, L_BC_alpha, ...) are AD properties that
+ * depend on the diffusion potentials, e.g. of ADQuaternaryConjugateKineticMaterial.
+ * Registered as ADMCContinuityEquationB, ADMCContinuityEquationC and
+ * ADMCContinuityEquationD.
+ */
+template <unsigned int C>
+class ADMCContinuityEquationTempl : public ADMultiCompMultiPhaseBase
+{
+public:
+  static InputParameters validParams();
+
+  ADMCContinuityEquationTempl(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  //Gradients of the diffusion potentials of B, C and D
+  std::array<const ADVariableGradient *, 3> _grad_diff_pot;
+
+  //Mobilities L_Ck of each phase
+  std::array<std::vector<const ADMaterialProperty<Real> *>, 3> _L;
+};
+
+typedef ADMCContinuityEquationTempl<0> ADMCContinuityEquationB;
+typedef ADMCContinuityEquationTempl<1> ADMCContinuityEquationC;
+typedef ADMCContinuityEquationTempl<2> ADMCContinuityEquationD;
@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "ADMultiCompMultiPhaseBase.h"
+
+// Forward Declarations
+template <unsigned int C>
+class ADMCPhaseConstraintMuTempl;
+
+/**
+ * AD version of MCPhaseConstraintMuB/C/D: enforce the sum of the phase
+ * compositions weighted by the interpolation functions to be the mole
+ * fraction of component C (0, 1, 2 for B, C, D) of a A-B-C-D alloy.
+ * The variable of the kernel is the diffusion potential of the component.
+ * The phase compositions (xB_alpha, ...) are AD properties that depend on
+ * the diffusion potentials, e.g. of ADQuaternaryConjugatePhaseMaterial.
+ * Registered as ADMCPhaseConstraintMuB, ADMCPhaseConstraintMuC and
+ * ADMCPhaseConstraintMuD.
+ */
+template <unsigned int C>
+class ADMCPhaseConstraintMuTempl : public ADMultiCompMultiPhaseBase
+{
+public:
+  static InputParameters validParams();
+
+  ADMCPhaseConstraintMuTempl(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  //Mole fraction of the component
+  const ADVariableValue & _x;
+
+  //Composition of each phase
+  std::vector<const ADMaterialProperty<Real> *> _x_phase;
+};
+
+typedef ADMCPhaseConstraintMuTempl<0> ADMCPhaseConstraintMuB;
+typedef ADMCPhaseConstraintMuTempl<1> ADMCPhaseConstraintMuC;
+typedef ADMCPhaseConstraintMuTempl<2> ADMCPhaseConstraintMuD;
@@ -0,0 +1,44 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * AD version of MultiCompContinuityEquationB, the continuity equation of
+ * component B of a two-phase A-B-C-D alloy on the diffusion potential of B.
+ * h (e.g. of ADInterpolationFunction) and the mobilities of each phase
+ * (e.g. of ADQuaternaryKineticMaterial) are AD properties, so the Jacobian
+ * of every variable they depend on is exact.
+ */
+class ADMultiCompContinuityEquationB : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADMultiCompContinuityEquationB(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpResidual() override;
+
+  const ADVariableGradient & _grad_C_diff_pot;
+  const ADVariableGradient & _grad_D_diff_pot;
+
+  //Isotropic Onsager mobility dependent on concentration
+  const ADMaterialProperty<Real> & _L_BB_beta;
+  const ADMaterialProperty<Real> & _L_BC_beta;
+  const ADMaterialProperty<Real> & _L_BD_beta;
+  const ADMaterialProperty<Real> & _L_BB_alpha;
+  const ADMaterialProperty<Real> & _L_BC_alpha;
+  const ADMaterialProperty<Real> & _L_BD_alpha;
+
+  //Interpolation function
+  const ADMaterialProperty<Real> & _h;
+};
@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "ADKernel.h"
+
+/**
+ * Base class of the AD kernels of a A-B-C-D alloy with up to five phases
+ * (ADMCPhaseConstraintMuB/C/D, ADMCContinuityEquationB/C/D).
+ * All the properties are AD properties: the interpolation functions h_alpha,
+ * h_beta, ... of ADQuantInterpolationFunction, and the phase properties
+ * (xB_alpha, L_BB_alpha, ...) of the AD phase materials
+ * (ADQuaternaryConjugatePhaseMaterial, ADQuaternaryConjugateKineticMaterial),
+ * so that the Jacobian is exact and no off-diagonal block has to be coded.
+ */
+class ADMultiCompMultiPhaseBase : public ADKernel
+{
+public:
+  static InputParameters validParams();
+
+  ADMultiCompMultiPhaseBase(const InputParameters & parameters);
+
+protected:
+  //Name of component k (B, C or D) and of the pair of components i, j as
+  //it appears in the property names (B, BC, BD, C, CD, D for the
+  //susceptibilities and BB, BC, ... for the mobilities)
+  static std::string component(unsigned int k);
+  static std::string pairName(unsigned int i, unsigned int j, bool repeat);
+
+  //AD properties <prefix><phase><suffix> of the coupled phases
+  std::vector<const ADMaterialProperty<Real> *> phaseProperties(const std::string & prefix,
+                                                                 const std::string & suffix = "");
+
+  //Number and names of the coupled phases
+  unsigned int _num_phases;
+  std::vector<std::string> _phase_names;
+
+  //Interpolation functions of the coupled phases
+  std::vector<const ADMaterialProperty<Real> *> _h;
+};
@@ -0,0 +1,66 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "ArrayKernel.h"
+
+/**
+ * Continuity equation of all the independent components of a ternary or
+ * quaternary alloy at once: the variable is the array of mole fractions
+ * (xB, xC[, xD]) and the flux of component i is sum_k L_ik * grad(mu_k),
+ * mu being the array of diffusion potentials in the same order.
+ * The interpolated mobility matrix and its derivatives are read from
+ * Ternary/QuaternaryMultiPhaseDiffusivity, so the properties are read once
+ * per quadrature point for all the components, and the coupled K x K
+ * blocks are assembled as dense matrices.
+ * To be used with ArrayTimeDerivative for the time derivative.
+ */
+class ArrayMCContinuityEquation : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArrayMCContinuityEquation(const InputParameters & parameters);
+
+protected:
+  virtual void initQpResidual() override;
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+  virtual void initQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  //Prefix of the properties of the diffusivity material
+  const std::string _base_name;
+
+  //Diffusion potentials
+  const ArrayVariableGradient & _grad_diff_pot;
+  const unsigned int _diff_pot_var;
+
+  //Phase field variables of the coupled phases
+  std::vector<unsigned int> _phase_var;
+
+  //Interpolated mobility, its derivatives w.r.t. each diffusion potential
+  //and w.r.t. each coupled phase field
+  const MaterialProperty<RealTensorValue> & _L;
+  std::vector<const MaterialProperty<RealTensorValue> *> _dL_dmu;
+  std::vector<const MaterialProperty<RealTensorValue> *> _dL_dphi;
+
+  //Mobility matrix at _qp and flux of each component (one row per component)
+  RealEigenMatrix _L_qp;
+  RealEigenMatrix _flux;
+
+  //Derivatives of the flux w.r.t. mu_k (or w.r.t. the phase field jvar)
+  std::vector<RealEigenMatrix> _dflux;
+
+private:
+  //Copy the leading _count x _count block of a tensor
+  void toEigen(const RealTensorValue & tensor, RealEigenMatrix & matrix) const;
+};
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+#include "ArrayKernel.h"
+
+/**
+ * Phase constraint of all the independent components of a ternary or
+ * quaternary alloy at once: the variable is the array of diffusion
+ * potentials (muB, muC[, muD]) and the kernel enforces
+ * sum_p h_p * x_i_p = x_i for every component i, x being the array of
+ * mole fractions in the same order.
+ * The phase compositions (xB_alpha, xC_alpha, ...) are read once per
+ * quadrature point for all the components, and the susceptibility block
+ * of the Jacobian is the matrix chi of Ternary/QuaternaryMultiPhaseDiffusivity.
+ */
+class ArrayMCPhaseConstraintMu : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+
+  ArrayMCPhaseConstraintMu(const InputParameters & parameters);
+
+protected:
+  virtual void initQpResidual() override;
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+  virtual void initQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+  virtual RealEigenMatrix computeQpOffDiagJacobian(const MooseVariableFEBase & jvar) override;
+
+  //Mole fractions
+  const ArrayVariableValue & _x;
+  const unsigned int _x_var;
+
+  //Phase field variables of the coupled phases
+  std::vector<unsigned int> _phase_var;
+
+  //Interpolation functions of the coupled phases, _dh[q][p] being the
+  //derivative of h_q w.r.t. phase field p (null for q == p)
+  std::vector<const MaterialProperty<Real> *> _h;
+  std::vector<std::vector<const MaterialProperty<Real> *>> _dh;
+
+  //Composition of each component in each coupled phase: [phase][component]
+  std::vector<std::vector<const MaterialProperty<Real> *>> _x_phase;
+
+  //Interpolated inverse thermodynamic factors of the diffusivity material
+  const std::string _base_name;
+  const MaterialProperty<RealTensorValue> & _chi;
+
+  //Sum of h_p * x_p - x at _qp, or its derivative w.r.t. the phase field
+  //jvar, and the block chi at _qp
+  RealEigenVector _mismatch;
+  RealEigenMatrix _chi_qp;
+};
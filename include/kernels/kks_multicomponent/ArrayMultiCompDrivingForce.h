@@ -0,0 +1,68 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include "Kernel.h"
+#include "InterfaceBand.h"
+
+/**
+ * Driving force of MultiCompDrivingForce, L*dh*(omega_2 - omega_1), for an
+ * alloy whose diffusion potentials (B, C[, D]) are an array variable, as
+ * solved by ArrayMCContinuityEquation and ArrayMCPhaseConstraintMu.
+ * The variable is the phase field of phase 1, and since
+ * d(omega)/d(mu_k) = -x_k the Jacobian w.r.t. the diffusion potentials is
+ * assembled for all the components of the array at once.
+ */
+class ArrayMultiCompDrivingForce : public Kernel
+{
+public:
+  static InputParameters validParams();
+
+  ArrayMultiCompDrivingForce(const InputParameters & parameters);
+
+  virtual void computeOffDiagJacobian(MooseVariableFEBase & jvar) override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+
+  //Whether the current element is away from the interfaces, where dh
+  //vanishes (see InterfaceBand)
+  bool inBulk() const { return _interface_band && _interface_band->isBulk(_current_elem); }
+
+  //Diffusion potentials
+  const unsigned int _diff_pot_var;
+  const unsigned int _count;
+
+  //Coupled phase fields (phase_2, then phase_3 to phase_5 if present) and
+  //the derivative of dh w.r.t. each of them
+  std::vector<unsigned int> _phase_var;
+  std::vector<const MaterialProperty<Real> *> _d2h_phase;
+
+  //Grand potential of both phases
+  const MaterialProperty<Real> & _A_chem_pot_1;
+  const MaterialProperty<Real> & _A_chem_pot_2;
+
+  //Mole fractions of each component in both phases
+  std::vector<const MaterialProperty<Real> *> _x_1;
+  std::vector<const MaterialProperty<Real> *> _x_2;
+
+  //Interpolation function derivatives
+  const MaterialProperty<Real> & _dh;
+  const MaterialProperty<Real> & _d2h;
+
+  //Phase-field mobility and non-dimensional factor
+  const MaterialProperty<Real> & _L;
+  const MaterialProperty<Real> & _nd_factor;
+
+  //Classification of the elements, if interface_band is given
+  const InterfaceBand * _interface_band;
+};
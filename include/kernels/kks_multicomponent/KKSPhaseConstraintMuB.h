@@ -13,10 +13,8 @@
 #include "MultiCompMultiPhaseBase.h"
 
 // Forward Declarations
-class KKSPhaseConstraintMuB;
-
-template <>
-InputParameters validParams<KKSPhaseConstraintMuB>();
+template <unsigned int P>
+class KKSPhaseConstraintMuBTempl;
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -24,18 +22,22 @@ InputParameters validParams<KKSPhaseConstraintMuB>();
  * the diffusion potential of component B
  * This kernel is coupled to the mole fraction of B
  * through the continuity equation
- *
+ * for P phases.
+ * Registered as KKSTwoPhaseConstraintMuB, KKSThreePhaseConstraintMuB and
+ * KKSPhaseConstraintMuB (five phases, the later three optional)
  */
-class KKSPhaseConstraintMuB : public MultiCompMultiPhaseBase
+template <unsigned int P>
+class KKSPhaseConstraintMuBTempl : public MultiCompMultiPhaseBaseTempl<P>
 {
 public:
-  KKSPhaseConstraintMuB(const InputParameters & parameters);
+  KKSPhaseConstraintMuBTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiCompMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
   // from a base class is overridden
-  
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
@@ -44,25 +46,31 @@ private:
 
   //Acts on the component B of alloy system A-B-C-D
   //Non-linear variable = B_diff_pot
-  
+
   const VariableValue & _xB;
   unsigned int _xB_var;
-  
-  //xC_alpha is a function of diffusion potentials B,C,D
-  const MaterialProperty<Real> & _xB_alpha;
-  const MaterialProperty<Real> & _xB_beta;
-  const MaterialProperty<Real> & _xB_gamma;
-  const MaterialProperty<Real> & _xB_delta;
-  const MaterialProperty<Real> & _xB_epsilon;
-  
-  //Diffusion potential of component C is a coupled 
-  //variable to this kernel for a ternary alloy A-B-C
+
+  //xB_alpha is a function of diffusion potentials B,C,D
+  const PhaseProperties _xB_phase;
+
+  //Diffusion potential of component C is a coupled
+  //variable to this kernel
   const VariableValue & _C_diff_pot;
   unsigned int _C_diff_pot_var;
-  
-  //For a quaternary alloy A-B-C-D
-  //Diffusion potential of component D is a coupled 
-  //variable to this kernel
+
+  //Diffusion potential of component D is a coupled
+  //variable to this kernel (zero for a ternary alloy)
   const VariableValue & _D_diff_pot;
   unsigned int _D_diff_pot_var;
 };
+
+typedef KKSPhaseConstraintMuBTempl<2> KKSTwoPhaseConstraintMuB;
+typedef KKSPhaseConstraintMuBTempl<3> KKSThreePhaseConstraintMuB;
+typedef KKSPhaseConstraintMuBTempl<5> KKSPhaseConstraintMuB;
+
+template <>
+InputParameters validParams<KKSTwoPhaseConstraintMuB>();
+template <>
+InputParameters validParams<KKSThreePhaseConstraintMuB>();
+template <>
+InputParameters validParams<KKSPhaseConstraintMuB>();
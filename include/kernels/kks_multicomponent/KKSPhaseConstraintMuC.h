@@ -14,10 +14,8 @@
 #include "MultiCompMultiPhaseBase.h"
 
 // Forward Declarations
-class KKSPhaseConstraintMuC;
-
-template <>
-InputParameters validParams<KKSPhaseConstraintMuC>();
+template <unsigned int P>
+class KKSPhaseConstraintMuCTempl;
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -25,44 +23,56 @@ InputParameters validParams<KKSPhaseConstraintMuC>();
  * is the mole fraction of comp C
  * This kernel will be coupled to diff_comp_B, eta, mole_fraction,
  * diff_comp_D
- *
+ * for P phases.
+ * Registered as KKSTwoPhaseConstraintMuC, KKSThreePhaseConstraintMuC and
+ * KKSPhaseConstraintMuC (five phases, the later three optional)
  */
-class KKSPhaseConstraintMuC : public MultiCompMultiPhaseBase
+template <unsigned int P>
+class KKSPhaseConstraintMuCTempl : public MultiCompMultiPhaseBaseTempl<P>
 {
 public:
-  KKSPhaseConstraintMuC(const InputParameters & parameters);
+  KKSPhaseConstraintMuCTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiCompMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
   // from a base class is overridden
-  
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
 private:
 
+  //Acts on the component C of alloy system A-B-C-D
+  //Non-linear variable = C_diff_pot
+
   const VariableValue & _xC;
   unsigned int _xC_var;
-  
+
   //xC_alpha is a function of diffusion potentials B,C,D
-  const MaterialProperty<Real> & _xC_alpha;
-  const MaterialProperty<Real> & _xC_beta;
-  const MaterialProperty<Real> & _xC_gamma;
-  const MaterialProperty<Real> & _xC_delta;
-  const MaterialProperty<Real> & _xC_epsilon;
-   
-  //Diffusion potential of component B is a coupled 
-  //variable to this kernel for a ternary alloy A-B-C
+  const PhaseProperties _xC_phase;
+
+  //Diffusion potential of component B is a coupled
+  //variable to this kernel
   const VariableValue & _B_diff_pot;
   unsigned int _B_diff_pot_var;
-    
-  //For a quaternary alloy A-B-C-D
-  //Diffusion potential of component D is a coupled 
-  //variable to this kernel
+
+  //Diffusion potential of component D is a coupled
+  //variable to this kernel (zero for a ternary alloy)
   const VariableValue & _D_diff_pot;
   unsigned int _D_diff_pot_var;
 };
 
-#endif // KKSPHASECONSTRAINTC_H
+typedef KKSPhaseConstraintMuCTempl<2> KKSTwoPhaseConstraintMuC;
+typedef KKSPhaseConstraintMuCTempl<3> KKSThreePhaseConstraintMuC;
+typedef KKSPhaseConstraintMuCTempl<5> KKSPhaseConstraintMuC;
+
+template <>
+InputParameters validParams<KKSTwoPhaseConstraintMuC>();
+template <>
+InputParameters validParams<KKSThreePhaseConstraintMuC>();
+template <>
+InputParameters validParams<KKSPhaseConstraintMuC>();
+#endif //KKSPHASECONSTRAINTMUC_H
@@ -14,10 +14,8 @@
 #include "MultiCompMultiPhaseBase.h"
 
 // Forward Declarations
-class KKSPhaseConstraintMuD;
-
-template <>
-InputParameters validParams<KKSPhaseConstraintMuD>();
+template <unsigned int P>
+class KKSPhaseConstraintMuDTempl;
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -25,47 +23,56 @@ InputParameters validParams<KKSPhaseConstraintMuD>();
  * is the diffusion potential of component D
  * This kernel will be coupled to diff_comp_B, eta, mole_fraction,
  * diff_comp_C
- *
+ * for P phases.
+ * Registered as KKSTwoPhaseConstraintMuD, KKSThreePhaseConstraintMuD and
+ * KKSPhaseConstraintMuD (five phases, the later three optional)
  */
-class KKSPhaseConstraintMuD : public MultiCompMultiPhaseBase
+template <unsigned int P>
+class KKSPhaseConstraintMuDTempl : public MultiCompMultiPhaseBaseTempl<P>
 {
 public:
-  KKSPhaseConstraintMuD(const InputParameters & parameters);
+  KKSPhaseConstraintMuDTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiCompMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
   // from a base class is overridden
-  
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
 private:
-  
-  //For a quaternary alloy A-B-C-D
-  //Mole fraction of component D is a coupled 
-  //variable to this kernel
+
+  //Acts on the component D of alloy system A-B-C-D
+  //Non-linear variable = D_diff_pot
+
   const VariableValue & _xD;
   unsigned int _xD_var;
-  
+
   //xD_alpha is a function of diffusion potentials B,C,D
-  const MaterialProperty<Real> & _xD_alpha;
-  const MaterialProperty<Real> & _xD_beta;
-  const MaterialProperty<Real> & _xD_gamma;
-  const MaterialProperty<Real> & _xD_delta;
-  const MaterialProperty<Real> & _xD_epsilon;
-  
-  //Diffusion potential of component C is a coupled 
-  //variable to this kernel for a quaternary alloy A-B-C-D
+  const PhaseProperties _xD_phase;
+
+  //Diffusion potential of component C is a coupled
+  //variable to this kernel
   const VariableValue & _C_diff_pot;
   unsigned int _C_diff_pot_var;
-  
-  //Diffusion potential of component B is a coupled 
-  //variable to this kernel for a quaternary alloy A-B-C-D   
+
+  //Diffusion potential of component B is a coupled
+  //variable to this kernel
   const VariableValue & _B_diff_pot;
   unsigned int _B_diff_pot_var;
-  
 };
 
-#endif // KKSPHASECONSTRAINTMUD_H
+typedef KKSPhaseConstraintMuDTempl<2> KKSTwoPhaseConstraintMuD;
+typedef KKSPhaseConstraintMuDTempl<3> KKSThreePhaseConstraintMuD;
+typedef KKSPhaseConstraintMuDTempl<5> KKSPhaseConstraintMuD;
+
+template <>
+InputParameters validParams<KKSTwoPhaseConstraintMuD>();
+template <>
+InputParameters validParams<KKSThreePhaseConstraintMuD>();
+template <>
+InputParameters validParams<KKSPhaseConstraintMuD>();
+#endif //KKSPHASECONSTRAINTD_H
@@ -14,57 +14,70 @@
 
 #include "MultiCompMultiPhaseBase.h"
 
-class MCContinuityEquationB;
-
-template<>
-InputParameters validParams<MCContinuityEquationB>();
+template <unsigned int P>
+class MCContinuityEquationBTempl;
 
 /**
-  *This class enforces the continuity equation for mass
+  *This class enforces the continuity equation on component B
   * The kernel operates on the variable : xB
+  * for a quaternary A-B-C-D alloy with P phases
+  * Registered as MCTwoPhaseContinuityEquationB, MCThreePhaseContinuityEquationB and
+  * MCContinuityEquationB (five phases, the later three optional)
   **/
 
-class  MCContinuityEquationB :  public MultiCompMultiPhaseBase
+template <unsigned int P>
+class MCContinuityEquationBTempl : public MultiCompMultiPhaseBaseTempl<P>
 {
-  public: 
-     MCContinuityEquationB(const InputParameters & parameters);
-  
+  public:
+     MCContinuityEquationBTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingMultiCompMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  private:  
-  
-    //Note all phase-field variables 
+  private:
+
+    //Note all phase-field variables
     //are inherited from the base class
-    
-    //Only chemical and mechanical variables 
+
+    //Only chemical and mechanical variables
     //need to be coupled
-     
-    //Mole fraction of C
+
+    //Mole fraction of component C
     const VariableGradient & _grad_xC;
     unsigned int _xC_var;
-    
-    //Mole fraction of D
+
+    //Mole fraction of component D
     const VariableGradient & _grad_xD;
     unsigned int _xD_var;
-    
+
     //Diffusion potential of comp. B
     const VariableGradient & _grad_B_diff_pot;
     unsigned int _B_diff_pot_var;
-    
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-    
+
     //Diffusion potential of comp. D
     const VariableGradient & _grad_D_diff_pot;
-    unsigned int _D_diff_pot_var; 
-   
+    unsigned int _D_diff_pot_var;
 };
+
+typedef MCContinuityEquationBTempl<2> MCTwoPhaseContinuityEquationB;
+typedef MCContinuityEquationBTempl<3> MCThreePhaseContinuityEquationB;
+typedef MCContinuityEquationBTempl<5> MCContinuityEquationB;
+
+template <>
+InputParameters validParams<MCTwoPhaseContinuityEquationB>();
+template <>
+InputParameters validParams<MCThreePhaseContinuityEquationB>();
+template <>
+InputParameters validParams<MCContinuityEquationB>();
 #endif //MCCONTINUITYEQUATIONB_H
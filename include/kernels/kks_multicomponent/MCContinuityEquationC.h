@@ -14,51 +14,70 @@
 
 #include "MultiCompMultiPhaseBase.h"
 
-class MCContinuityEquationC;
-
-template<>
-InputParameters validParams< MCContinuityEquationC>();
+template <unsigned int P>
+class MCContinuityEquationCTempl;
 
 /**
   *This class enforces the continuity equation on component C
-  * The kernel operates on the variable : Xc
+  * The kernel operates on the variable : xC
+  * for a quaternary A-B-C-D alloy with P phases
+  * Registered as MCTwoPhaseContinuityEquationC, MCThreePhaseContinuityEquationC and
+  * MCContinuityEquationC (five phases, the later three optional)
   **/
 
-class  MCContinuityEquationC:  public MultiCompMultiPhaseBase
+template <unsigned int P>
+class MCContinuityEquationCTempl : public MultiCompMultiPhaseBaseTempl<P>
 {
-  public: 
-     MCContinuityEquationC(const InputParameters & parameters);
-  
+  public:
+     MCContinuityEquationCTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingMultiCompMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   private:
-    
+
+    //Note all phase-field variables
+    //are inherited from the base class
+
+    //Only chemical and mechanical variables
+    //need to be coupled
+
     //Mole fraction of component B
     const VariableGradient & _grad_xB;
     unsigned int _xB_var;
-    
+
     //Mole fraction of component D
     const VariableGradient & _grad_xD;
     unsigned int _xD_var;
-    
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-  
+
     //Diffusion potential of comp. B
     const VariableGradient & _grad_B_diff_pot;
     unsigned int _B_diff_pot_var;
-    
+
     //Diffusion potential of comp. D
     const VariableGradient & _grad_D_diff_pot;
-    unsigned int _D_diff_pot_var; 
-    
+    unsigned int _D_diff_pot_var;
 };
+
+typedef MCContinuityEquationCTempl<2> MCTwoPhaseContinuityEquationC;
+typedef MCContinuityEquationCTempl<3> MCThreePhaseContinuityEquationC;
+typedef MCContinuityEquationCTempl<5> MCContinuityEquationC;
+
+template <>
+InputParameters validParams<MCTwoPhaseContinuityEquationC>();
+template <>
+InputParameters validParams<MCThreePhaseContinuityEquationC>();
+template <>
+InputParameters validParams<MCContinuityEquationC>();
 #endif //MCCONTINUITYEQUATIONC_H
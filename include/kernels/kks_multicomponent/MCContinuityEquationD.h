@@ -14,56 +14,70 @@
 
 #include "MultiCompMultiPhaseBase.h"
 
-class MCContinuityEquationD;
-
-template<>
-InputParameters validParams<MCContinuityEquationD>();
+template <unsigned int P>
+class MCContinuityEquationDTempl;
 
 /**
-  *This class enforces the following 
-  *Equation in the KKS model
-  *w* mu  = 0
-  *mu - Diffusion potential df/dc = df/dc_alpha = df/dc_beta
-  *df/dc_beta - first derivate of the free energy of the beta
-  * phase. This is assumed to be a parabolic form
-  * The kernel operates on the variable : c
+  *This class enforces the continuity equation on component D
+  * The kernel operates on the variable : xD
+  * for a quaternary A-B-C-D alloy with P phases
+  * Registered as MCTwoPhaseContinuityEquationD, MCThreePhaseContinuityEquationD and
+  * MCContinuityEquationD (five phases, the later three optional)
   **/
 
-class MCContinuityEquationD:  public MultiCompMultiPhaseBase
+template <unsigned int P>
+class MCContinuityEquationDTempl : public MultiCompMultiPhaseBaseTempl<P>
 {
-  public: 
-     MCContinuityEquationD(const InputParameters & parameters);
-  
+  public:
+     MCContinuityEquationDTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingMultiCompMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   private:
-  
+
+    //Note all phase-field variables
+    //are inherited from the base class
+
+    //Only chemical and mechanical variables
+    //need to be coupled
+
     //Mole fraction of component C
     const VariableGradient & _grad_xC;
     unsigned int _xC_var;
-    
+
     //Mole fraction of component B
     const VariableGradient & _grad_xB;
     unsigned int _xB_var;
-    
-     //Diffusion potential of comp. D
+
+    //Diffusion potential of comp. D
     const VariableGradient & _grad_D_diff_pot;
-    unsigned int _D_diff_pot_var; 
-    
-    //Diffusion potential of comp. B
-    const VariableGradient & _grad_B_diff_pot;
-    unsigned int _B_diff_pot_var;
-    
+    unsigned int _D_diff_pot_var;
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-    
+
+    //Diffusion potential of comp. B
+    const VariableGradient & _grad_B_diff_pot;
+    unsigned int _B_diff_pot_var;
 };
+
+typedef MCContinuityEquationDTempl<2> MCTwoPhaseContinuityEquationD;
+typedef MCContinuityEquationDTempl<3> MCThreePhaseContinuityEquationD;
+typedef MCContinuityEquationDTempl<5> MCContinuityEquationD;
+
+template <>
+InputParameters validParams<MCTwoPhaseContinuityEquationD>();
+template <>
+InputParameters validParams<MCThreePhaseContinuityEquationD>();
+template <>
+InputParameters validParams<MCContinuityEquationD>();
 #endif //MCCONTINUITYEQUATIOND_H
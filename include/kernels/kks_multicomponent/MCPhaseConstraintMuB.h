@@ -13,10 +13,8 @@
 #include "TCPhaseConstraintMuB.h"
 
 // Forward Declarations
-class MCPhaseConstraintMuB;
-
-template <>
-InputParameters validParams<MCPhaseConstraintMuB>();
+template <unsigned int P>
+class MCPhaseConstraintMuBTempl;
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -24,35 +22,44 @@ InputParameters validParams<MCPhaseConstraintMuB>();
  * the diffusion potential of component B for a A-B-C-D alloy
  * This kernel is coupled to the mole fraction of B
  * through the continuity equation
- *
+ * for P phases.
+ * Registered as MCTwoPhaseConstraintMuB, MCThreePhaseConstraintMuB and
+ * MCPhaseConstraintMuB (five phases, the later three optional)
  */
-class MCPhaseConstraintMuB : public TCPhaseConstraintMuB
+template <unsigned int P>
+class MCPhaseConstraintMuBTempl : public TCPhaseConstraintMuBTempl<P>
 {
 public:
-  MCPhaseConstraintMuB(const InputParameters & parameters);
+  MCPhaseConstraintMuBTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
-  // from a base class is overridden  
-  virtual Real computeQpResidual() override;
-  virtual Real computeQpJacobian() override;
+  // from a base class is overridden
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
 private:
 
   Real chi_BD() const;
-  
+
   //First derivative xB with respect to comp D diffusion potential
-  const MaterialProperty<Real> & _inv_BD_tf_alpha;
-  const MaterialProperty<Real> & _inv_BD_tf_beta;
-  const MaterialProperty<Real> & _inv_BD_tf_gamma;
-  const MaterialProperty<Real> & _inv_BD_tf_delta; 
-  const MaterialProperty<Real> & _inv_BD_tf_epsilon; 
-  
+  const PhaseProperties _inv_BD_tf;
+
   //For a quaternary alloy A-B-C-D
-  //Diffusion potential of component D is a coupled 
+  //Diffusion potential of component D is a coupled
   //variable to this kernel
   const VariableValue & _D_diff_pot;
   unsigned int _D_diff_pot_var;
 };
+
+typedef MCPhaseConstraintMuBTempl<2> MCTwoPhaseConstraintMuB;
+typedef MCPhaseConstraintMuBTempl<3> MCThreePhaseConstraintMuB;
+typedef MCPhaseConstraintMuBTempl<5> MCPhaseConstraintMuB;
+
+template <>
+InputParameters validParams<MCTwoPhaseConstraintMuB>();
+template <>
+InputParameters validParams<MCThreePhaseConstraintMuB>();
+template <>
+InputParameters validParams<MCPhaseConstraintMuB>();
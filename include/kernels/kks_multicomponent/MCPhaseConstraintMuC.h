@@ -13,10 +13,8 @@
 #include "TCPhaseConstraintMuC.h"
 
 // Forward Declarations
-class MCPhaseConstraintMuC;
-
-template <>
-InputParameters validParams<MCPhaseConstraintMuC>();
+template <unsigned int P>
+class MCPhaseConstraintMuCTempl;
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -24,35 +22,44 @@ InputParameters validParams<MCPhaseConstraintMuC>();
  * the diffusion potential of component B for a A-B-C-D alloy
  * This kernel is coupled to the mole fraction of C
  * through the continuity equation
- *
+ * for P phases.
+ * Registered as MCTwoPhaseConstraintMuC, MCThreePhaseConstraintMuC and
+ * MCPhaseConstraintMuC (five phases, the later three optional)
  */
-class MCPhaseConstraintMuC : public TCPhaseConstraintMuC
+template <unsigned int P>
+class MCPhaseConstraintMuCTempl : public TCPhaseConstraintMuCTempl<P>
 {
 public:
-  MCPhaseConstraintMuC(const InputParameters & parameters);
+  MCPhaseConstraintMuCTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
-  // from a base class is overridden  
-  virtual Real computeQpResidual() override;
-  virtual Real computeQpJacobian() override;
+  // from a base class is overridden
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
 private:
 
   Real chi_CD() const;
-  
+
   //First derivative xC with respect to comp D diffusion potential
-  const MaterialProperty<Real> & _inv_CD_tf_alpha;
-  const MaterialProperty<Real> & _inv_CD_tf_beta;
-  const MaterialProperty<Real> & _inv_CD_tf_gamma;
-  const MaterialProperty<Real> & _inv_CD_tf_delta; 
-  const MaterialProperty<Real> & _inv_CD_tf_epsilon; 
-  
+  const PhaseProperties _inv_CD_tf;
+
   //For a quaternary alloy A-B-C-D
-  //Diffusion potential of component D is also a coupled 
+  //Diffusion potential of component D is also a coupled
   //variable to this kernel
   const VariableValue & _D_diff_pot;
   unsigned int _D_diff_pot_var;
 };
+
+typedef MCPhaseConstraintMuCTempl<2> MCTwoPhaseConstraintMuC;
+typedef MCPhaseConstraintMuCTempl<3> MCThreePhaseConstraintMuC;
+typedef MCPhaseConstraintMuCTempl<5> MCPhaseConstraintMuC;
+
+template <>
+InputParameters validParams<MCTwoPhaseConstraintMuC>();
+template <>
+InputParameters validParams<MCThreePhaseConstraintMuC>();
+template <>
+InputParameters validParams<MCPhaseConstraintMuC>();
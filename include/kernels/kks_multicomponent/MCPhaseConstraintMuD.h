@@ -12,10 +12,8 @@
 #include "MultiPhaseBase.h"
 
 // Forward Declarations
-class MCPhaseConstraintMuD;
-
-template <>
-InputParameters validParams<MCPhaseConstraintMuD>();
+template <unsigned int P>
+class MCPhaseConstraintMuDTempl;
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -23,18 +21,22 @@ InputParameters validParams<MCPhaseConstraintMuD>();
  * is the diffusion potential of component D
  * This kernel will be coupled to diff_comp_B, eta, mole_fraction,
  * diff_comp_C
- *
+ * for P phases.
+ * Registered as MCTwoPhaseConstraintMuD, MCThreePhaseConstraintMuD and
+ * MCPhaseConstraintMuD (five phases, the later three optional)
  */
-class MCPhaseConstraintMuD : public MultiPhaseBase
+template <unsigned int P>
+class MCPhaseConstraintMuDTempl : public MultiPhaseBaseTempl<P>
 {
 public:
-  MCPhaseConstraintMuD(const InputParameters & parameters);
+  MCPhaseConstraintMuDTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
   // from a base class is overridden
-  
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
@@ -44,48 +46,43 @@ private:
   Real chi_CD() const;
   Real chi_BD() const;
   Real chi_DD() const;
-  
+
   //For a quaternary alloy A-B-C-D
-  //Mole fraction of component D is a coupled 
+  //Mole fraction of component D is a coupled
   //variable to this kernel
   const VariableValue & _xD;
   unsigned int _xD_var;
-  
+
   //xD_alpha is a function of diffusion potentials B,C,D
-  const MaterialProperty<Real> & _xD_alpha;
-  const MaterialProperty<Real> & _xD_beta;
-  const MaterialProperty<Real> & _xD_gamma;
-  const MaterialProperty<Real> & _xD_delta;
-  const MaterialProperty<Real> & _xD_epsilon;
-    
+  const PhaseProperties _xD_phase;
+
   //First derivative xD with respect to comp C diffusion potential
-  const MaterialProperty<Real> & _inv_CD_tf_alpha;
-  const MaterialProperty<Real> & _inv_CD_tf_beta;
-  const MaterialProperty<Real> & _inv_CD_tf_gamma;
-  const MaterialProperty<Real> & _inv_CD_tf_delta; 
-  const MaterialProperty<Real> & _inv_CD_tf_epsilon; 
-  
+  const PhaseProperties _inv_CD_tf;
+
   //First derivative xD with respect to comp B diffusion potential
-  const MaterialProperty<Real> & _inv_BD_tf_alpha;
-  const MaterialProperty<Real> & _inv_BD_tf_beta;
-  const MaterialProperty<Real> & _inv_BD_tf_gamma;
-  const MaterialProperty<Real> & _inv_BD_tf_delta; 
-  const MaterialProperty<Real> & _inv_BD_tf_epsilon;
-  
+  const PhaseProperties _inv_BD_tf;
+
   //First derivative xD with respect to comp D diffusion potential
-  const MaterialProperty<Real> & _inv_D_tf_alpha;
-  const MaterialProperty<Real> & _inv_D_tf_beta;
-  const MaterialProperty<Real> & _inv_D_tf_gamma;
-  const MaterialProperty<Real> & _inv_D_tf_delta; 
-  const MaterialProperty<Real> & _inv_D_tf_epsilon; 
+  const PhaseProperties _inv_D_tf;
 
-  //Diffusion potential of component C is a coupled 
+  //Diffusion potential of component C is a coupled
   //variable to this kernel for a quaternary alloy A-B-C-D
   const VariableValue & _C_diff_pot;
   unsigned int _C_diff_pot_var;
-  
-  //Diffusion potential of component B is a coupled 
-  //variable to this kernel for a quaternary alloy A-B-C-D   
+
+  //Diffusion potential of component B is a coupled
+  //variable to this kernel for a quaternary alloy A-B-C-D
   const VariableValue & _B_diff_pot;
-  unsigned int _B_diff_pot_var; 
+  unsigned int _B_diff_pot_var;
 };
+
+typedef MCPhaseConstraintMuDTempl<2> MCTwoPhaseConstraintMuD;
+typedef MCPhaseConstraintMuDTempl<3> MCThreePhaseConstraintMuD;
+typedef MCPhaseConstraintMuDTempl<5> MCPhaseConstraintMuD;
+
+template <>
+InputParameters validParams<MCTwoPhaseConstraintMuD>();
+template <>
+InputParameters validParams<MCThreePhaseConstraintMuD>();
+template <>
+InputParameters validParams<MCPhaseConstraintMuD>();
@@ -12,49 +12,61 @@
 #pragma once
 #include "TernaryMultiPhaseBase.h"
 
-class TCContinuityEquationB;
-
-template<>
-InputParameters validParams<TCContinuityEquationB>();
+template <unsigned int P>
+class TCContinuityEquationBTempl;
 
 /**
   *This class enforces the continuity equation for mass
   * The kernel operates on the variable : xB
-  * for a ternary A-B-C alloy
+  * for a ternary A-B-C alloy with P phases
+  * Registered as TCTwoPhaseContinuityEquationB, TCThreePhaseContinuityEquationB and
+  * TCContinuityEquationB (five phases, the later three optional)
   **/
 
-class  TCContinuityEquationB :  public TernaryMultiPhaseBase
+template <unsigned int P>
+class TCContinuityEquationBTempl : public TernaryMultiPhaseBaseTempl<P>
 {
-  public: 
-     TCContinuityEquationB(const InputParameters & parameters);
-  
+  public:
+     TCContinuityEquationBTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingTernaryMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  private:  
-  
-    //Note all phase-field variables 
+  private:
+
+    //Note all phase-field variables
     //are inherited from the base class
-    
-    //Only chemical and mechanical variables 
+
+    //Only chemical and mechanical variables
     //need to be coupled
-     
+
     //Mole fraction of C
     const VariableGradient & _grad_xC;
     unsigned int _xC_var;
-      
+
     //Diffusion potential of comp. B
     const VariableGradient & _grad_B_diff_pot;
     unsigned int _B_diff_pot_var;
-    
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-       
 };
+
+typedef TCContinuityEquationBTempl<2> TCTwoPhaseContinuityEquationB;
+typedef TCContinuityEquationBTempl<3> TCThreePhaseContinuityEquationB;
+typedef TCContinuityEquationBTempl<5> TCContinuityEquationB;
+
+template <>
+InputParameters validParams<TCTwoPhaseContinuityEquationB>();
+template <>
+InputParameters validParams<TCThreePhaseContinuityEquationB>();
+template <>
+InputParameters validParams<TCContinuityEquationB>();
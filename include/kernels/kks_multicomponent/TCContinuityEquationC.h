@@ -14,49 +14,62 @@
 
 #include "TernaryMultiPhaseBase.h"
 
-class TCContinuityEquationC;
-
-template<>
-InputParameters validParams< TCContinuityEquationC>();
+template <unsigned int P>
+class TCContinuityEquationCTempl;
 
 /**
   *This class enforces the continuity equation on component C
   * The kernel operates on the variable : Xc
+  * for a ternary A-B-C alloy with P phases
+  * Registered as TCTwoPhaseContinuityEquationC, TCThreePhaseContinuityEquationC and
+  * TCContinuityEquationC (five phases, the later three optional)
   **/
 
-class  TCContinuityEquationC:  public TernaryMultiPhaseBase
+template <unsigned int P>
+class TCContinuityEquationCTempl : public TernaryMultiPhaseBaseTempl<P>
 {
-  public: 
-     TCContinuityEquationC(const InputParameters & parameters);
-  
+  public:
+     TCContinuityEquationCTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingTernaryMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   private:
-  
-    //Note all phase-field variables 
+
+    //Note all phase-field variables
     //are inherited from the base class
-    
-    //Only chemical and mechanical variables 
+
+    //Only chemical and mechanical variables
     //need to be coupled
-    
+
     //Mole fraction of component B
     const VariableGradient & _grad_xB;
     unsigned int _xB_var;
-    
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-  
+
     //Diffusion potential of comp. B
     const VariableGradient & _grad_B_diff_pot;
     unsigned int _B_diff_pot_var;
-        
 };
+
+typedef TCContinuityEquationCTempl<2> TCTwoPhaseContinuityEquationC;
+typedef TCContinuityEquationCTempl<3> TCThreePhaseContinuityEquationC;
+typedef TCContinuityEquationCTempl<5> TCContinuityEquationC;
+
+template <>
+InputParameters validParams<TCTwoPhaseContinuityEquationC>();
+template <>
+InputParameters validParams<TCThreePhaseContinuityEquationC>();
+template <>
+InputParameters validParams<TCContinuityEquationC>();
 #endif //TCCONTINUITYEQUATIONC_H
@@ -13,10 +13,11 @@
 #include "MultiPhaseBase.h"
 
 // Forward Declarations
-class TCPhaseConstraintMuB;
+template <unsigned int P>
+class TCPhaseConstraintMuBTempl;
 
-template <>
-InputParameters validParams<TCPhaseConstraintMuB>();
+//Parameters of TCPhaseConstraintMuBTempl<num_phases>
+InputParameters tcPhaseConstraintMuBParams(unsigned int num_phases);
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -24,61 +25,61 @@ InputParameters validParams<TCPhaseConstraintMuB>();
  * the diffusion potential of component B
  * This kernel is coupled to the mole fraction of B
  * through the continuity equation
- *
+ * for P phases.
+ * Registered as TCTwoPhaseConstraintMuB, TCThreePhaseConstraintMuB and
+ * TCPhaseConstraintMuB (five phases, the later three optional)
  */
-class TCPhaseConstraintMuB : public MultiPhaseBase
+template <unsigned int P>
+class TCPhaseConstraintMuBTempl : public MultiPhaseBaseTempl<P>
 {
 public:
-  TCPhaseConstraintMuB(const InputParameters & parameters);
+  TCPhaseConstraintMuBTempl(const InputParameters & parameters);
 
 protected:
-  
+  usingMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
   // from a base class is overridden
-  
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   Real chi_BB() const;
   Real chi_BC() const;
-  
+
   //Acts on the component B of alloy system A-B-C
   //Non-linear variable = B_diff_pot
-  
+
   const VariableValue & _xB;
   unsigned int _xB_var;
-  
+
   //xC_alpha is a function of diffusion potentials B,C,D
-  const MaterialProperty<Real> & _xB_alpha;
-  const MaterialProperty<Real> & _xB_beta;
-  const MaterialProperty<Real> & _xB_gamma;
-  const MaterialProperty<Real> & _xB_delta;
-  const MaterialProperty<Real> & _xB_epsilon;
-  
+  const PhaseProperties _xB_phase;
+
   //Consequently each material property should depend on phase
   //First derivative xB with respect to comp B diffusion potential
-  const MaterialProperty<Real> & _inv_B_tf_alpha;
-  const MaterialProperty<Real> & _inv_B_tf_beta;
-  const MaterialProperty<Real> & _inv_B_tf_gamma;
-  const MaterialProperty<Real> & _inv_B_tf_delta; 
-  const MaterialProperty<Real> & _inv_B_tf_epsilon; 
-  
+  const PhaseProperties _inv_B_tf;
+
   //First derivative xB with respect to comp C diffusion potential
-  const MaterialProperty<Real> & _inv_BC_tf_alpha;
-  const MaterialProperty<Real> & _inv_BC_tf_beta;
-  const MaterialProperty<Real> & _inv_BC_tf_gamma;
-  const MaterialProperty<Real> & _inv_BC_tf_delta; 
-  const MaterialProperty<Real> & _inv_BC_tf_epsilon; 
-  
-  //Diffusion potential of component C is a coupled 
+  const PhaseProperties _inv_BC_tf;
+
+  //Diffusion potential of component C is a coupled
   //variable to this kernel for a ternary alloy A-B-C
   const VariableValue & _C_diff_pot;
   unsigned int _C_diff_pot_var;
-  
-  //For a quaternary alloy A-B-C-D
-  //Diffusion potential of component D is a coupled 
-  //variable to this kernel
-  //const VariableValue & _D_diff_pot;
-  //unsigned int _D_diff_pot_var;
+
+  //chi computed once per quadrature point by TernaryMultiPhaseDiffusivity,
+  //read by chi_*() when precomputed_diffusivity is set (null otherwise)
+  const MaterialProperty<RealTensorValue> * _chi_matrix;
 };
+
+typedef TCPhaseConstraintMuBTempl<2> TCTwoPhaseConstraintMuB;
+typedef TCPhaseConstraintMuBTempl<3> TCThreePhaseConstraintMuB;
+typedef TCPhaseConstraintMuBTempl<5> TCPhaseConstraintMuB;
+
+template <>
+InputParameters validParams<TCTwoPhaseConstraintMuB>();
+template <>
+InputParameters validParams<TCThreePhaseConstraintMuB>();
+template <>
+InputParameters validParams<TCPhaseConstraintMuB>();
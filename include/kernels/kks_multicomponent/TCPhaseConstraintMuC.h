@@ -13,10 +13,11 @@
 #include "MultiPhaseBase.h"
 
 // Forward Declarations
-class TCPhaseConstraintMuC;
+template <unsigned int P>
+class TCPhaseConstraintMuCTempl;
 
-template <>
-InputParameters validParams<TCPhaseConstraintMuC>();
+//Parameters of TCPhaseConstraintMuCTempl<num_phases>
+InputParameters tcPhaseConstraintMuCParams(unsigned int num_phases);
 
 /**
  * Enforce sum of phase concentrations to be the real concentration.
@@ -24,58 +25,60 @@ InputParameters validParams<TCPhaseConstraintMuC>();
  * is the mole fraction of comp C
  * This kernel will be coupled to diff_comp_B, eta, mole_fraction,
  * diff_comp_D
- *
+ * for P phases.
+ * Registered as TCTwoPhaseConstraintMuC, TCThreePhaseConstraintMuC and
+ * TCPhaseConstraintMuC (five phases, the later three optional)
  */
-class TCPhaseConstraintMuC : public MultiPhaseBase
+template <unsigned int P>
+class TCPhaseConstraintMuCTempl : public MultiPhaseBaseTempl<P>
 {
 public:
-  TCPhaseConstraintMuC(const InputParameters & parameters);
+  TCPhaseConstraintMuCTempl(const InputParameters & parameters);
 
 protected:
+  usingMultiPhaseBaseMembers(P);
+
   // The override command ensures that a virtual member function
-  // from a base class is overridden  
+  // from a base class is overridden
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
-  
+
   Real chi_BC() const;
   Real chi_CC() const;
 
   //Acts on the component C of alloy system A-B-C
   //Non-linear variable = C_diff_pot
-  
+
   const VariableValue & _xC;
   unsigned int _xC_var;
-  
+
   //xC_alpha is a function of diffusion potentials B,C,D
-  const MaterialProperty<Real> & _xC_alpha;
-  const MaterialProperty<Real> & _xC_beta;
-  const MaterialProperty<Real> & _xC_gamma;
-  const MaterialProperty<Real> & _xC_delta;
-  const MaterialProperty<Real> & _xC_epsilon;
-  
+  const PhaseProperties _xC_phase;
+
   //First derivative xB with respect to comp C diffusion potential
-  const MaterialProperty<Real> & _inv_BC_tf_alpha;
-  const MaterialProperty<Real> & _inv_BC_tf_beta;
-  const MaterialProperty<Real> & _inv_BC_tf_gamma;
-  const MaterialProperty<Real> & _inv_BC_tf_delta; 
-  const MaterialProperty<Real> & _inv_BC_tf_epsilon; 
-  
+  const PhaseProperties _inv_BC_tf;
+
   //First derivative xC with respect to comp C diffusion potential
-  const MaterialProperty<Real> & _inv_C_tf_alpha;
-  const MaterialProperty<Real> & _inv_C_tf_beta;
-  const MaterialProperty<Real> & _inv_C_tf_gamma;
-  const MaterialProperty<Real> & _inv_C_tf_delta; 
-  const MaterialProperty<Real> & _inv_C_tf_epsilon; 
-   
-  //Diffusion potential of component B is a coupled 
+  const PhaseProperties _inv_C_tf;
+
+  //Diffusion potential of component B is a coupled
   //variable to this kernel for a ternary alloy A-B-C
   const VariableValue & _B_diff_pot;
   unsigned int _B_diff_pot_var;
-    
-  //For a quaternary alloy A-B-C-D
-  //Diffusion potential of component D is a coupled 
-  //variable to this kernel
-  //const VariableValue & _D_diff_pot;
-  //unsigned int _D_diff_pot_var;
+
+  //chi computed once per quadrature point by TernaryMultiPhaseDiffusivity,
+  //read by chi_*() when precomputed_diffusivity is set (null otherwise)
+  const MaterialProperty<RealTensorValue> * _chi_matrix;
 };
+
+typedef TCPhaseConstraintMuCTempl<2> TCTwoPhaseConstraintMuC;
+typedef TCPhaseConstraintMuCTempl<3> TCThreePhaseConstraintMuC;
+typedef TCPhaseConstraintMuCTempl<5> TCPhaseConstraintMuC;
+
+template <>
+InputParameters validParams<TCTwoPhaseConstraintMuC>();
+template <>
+InputParameters validParams<TCThreePhaseConstraintMuC>();
+template <>
+InputParameters validParams<TCPhaseConstraintMuC>();
@@ -14,49 +14,62 @@
 
 #include "TernaryMultiPhaseBase.h"
 
-class TernaryContinuityEquationB;
-
-template<>
-InputParameters validParams<TernaryContinuityEquationB>();
+template <unsigned int P>
+class TernaryContinuityEquationBTempl;
 
 /**
   *This class enforces the continuity equation for mass
   * The kernel operates on the variable : xB
+  * for a ternary A-B-C alloy with P phases
+  * Registered as TernaryTwoPhaseContinuityEquationB, TernaryThreePhaseContinuityEquationB and
+  * TernaryContinuityEquationB (five phases, the later three optional)
   **/
 
-class  TernaryContinuityEquationB :  public TernaryMultiPhaseBase
+template <unsigned int P>
+class TernaryContinuityEquationBTempl : public TernaryMultiPhaseBaseTempl<P>
 {
-  public: 
-     TernaryContinuityEquationB(const InputParameters & parameters);
-  
+  public:
+     TernaryContinuityEquationBTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingTernaryMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
-  private:  
-  
-    //Note all phase-field variables 
+  private:
+
+    //Note all phase-field variables
     //are inherited from the base class
-    
-    //Only chemical and mechanical variables 
+
+    //Only chemical and mechanical variables
     //need to be coupled
-     
+
     //Mole fraction of C
     const VariableGradient & _grad_xC;
     unsigned int _xC_var;
-      
+
     //Diffusion potential of comp. B
     const VariableGradient & _grad_B_diff_pot;
     unsigned int _B_diff_pot_var;
-    
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-       
 };
+
+typedef TernaryContinuityEquationBTempl<2> TernaryTwoPhaseContinuityEquationB;
+typedef TernaryContinuityEquationBTempl<3> TernaryThreePhaseContinuityEquationB;
+typedef TernaryContinuityEquationBTempl<5> TernaryContinuityEquationB;
+
+template <>
+InputParameters validParams<TernaryTwoPhaseContinuityEquationB>();
+template <>
+InputParameters validParams<TernaryThreePhaseContinuityEquationB>();
+template <>
+InputParameters validParams<TernaryContinuityEquationB>();
 #endif //TERNARYCONTINUITYEQUATIONB_H
@@ -14,44 +14,62 @@
 
 #include "TernaryMultiPhaseBase.h"
 
-class TernaryContinuityEquationC;
-
-template<>
-InputParameters validParams< TernaryContinuityEquationC>();
+template <unsigned int P>
+class TernaryContinuityEquationCTempl;
 
 /**
   *This class enforces the continuity equation on component C
   * The kernel operates on the variable : Xc
+  * for a ternary A-B-C alloy with P phases
+  * Registered as TernaryTwoPhaseContinuityEquationC, TernaryThreePhaseContinuityEquationC and
+  * TernaryContinuityEquationC (five phases, the later three optional)
   **/
 
-class  TernaryContinuityEquationC:  public TernaryMultiPhaseBase
+template <unsigned int P>
+class TernaryContinuityEquationCTempl : public TernaryMultiPhaseBaseTempl<P>
 {
-  public: 
-     TernaryContinuityEquationC(const InputParameters & parameters);
-  
+  public:
+     TernaryContinuityEquationCTempl(const InputParameters & parameters);
+
   protected:
-  
+    usingTernaryMultiPhaseBaseMembers(P);
+
     // The override command ensures that a virtual member function
     // from a base class is overridden
-    
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   private:
-    
+
+    //Note all phase-field variables
+    //are inherited from the base class
+
+    //Only chemical and mechanical variables
+    //need to be coupled
+
     //Mole fraction of component B
     const VariableGradient & _grad_xB;
     unsigned int _xB_var;
-    
+
     //Diffusion potential of comp. C
     const VariableGradient & _grad_C_diff_pot;
     unsigned int _C_diff_pot_var;
-  
+
     //Diffusion potential of comp. B
     const VariableGradient & _grad_B_diff_pot;
     unsigned int _B_diff_pot_var;
-    
-    
 };
+
+typedef TernaryContinuityEquationCTempl<2> TernaryTwoPhaseContinuityEquationC;
+typedef TernaryContinuityEquationCTempl<3> TernaryThreePhaseContinuityEquationC;
+typedef TernaryContinuityEquationCTempl<5> TernaryContinuityEquationC;
+
+template <>
+InputParameters validParams<TernaryTwoPhaseContinuityEquationC>();
+template <>
+InputParameters validParams<TernaryThreePhaseContinuityEquationC>();
+template <>
+InputParameters validParams<TernaryContinuityEquationC>();
 #endif //TERNARYCONTINUITYEQUATIONC_H
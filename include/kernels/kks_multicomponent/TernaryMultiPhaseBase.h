@@ -10,35 +10,40 @@
 #pragma once
 #include "MultiPhaseBase.h"
 
-class TernaryMultiPhaseBase;
+template <unsigned int P>
+class TernaryMultiPhaseBaseTempl;
 
-template <>
-InputParameters validParams<TernaryMultiPhaseBase>();
+//Parameters of TernaryMultiPhaseBaseTempl<num_phases>
+InputParameters ternaryMultiPhaseBaseParams(unsigned int num_phases);
 
 /**
  * Kernel to precompute
  * the a)overall diffusivity matrix
  * and b)overall Onsager mobility and its derivatives
- * for a ternary A-B-C alloy
+ * for a ternary A-B-C alloy with P phases
+ * Registered as TernaryMultiPhaseBase (five phases, the later three optional)
  */
-class TernaryMultiPhaseBase: public MultiPhaseBase
+template <unsigned int P>
+class TernaryMultiPhaseBaseTempl : public MultiPhaseBaseTempl<P>
 {
 public:
-  TernaryMultiPhaseBase(const InputParameters & parameters);
+  TernaryMultiPhaseBaseTempl(const InputParameters & parameters);
 
 protected:
+  usingMultiPhaseBaseMembers(P);
+
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
-  
+
   //Overall chi matrix
   Real chi_BB() const;
   Real chi_BC() const;
   Real chi_CC() const;
-  
+
   //Determinant of the overall susceptibility matrix
   Real det_chi() const;
-  
+
   //Overall thermodynamic factors for a quartenary alloy
   Real thermodynamic_factorBB() const;
   Real thermodynamic_factorBC() const;
@@ -48,138 +53,100 @@ protected:
   Real L_BB_interp() const;
   Real L_BC_interp() const;
   Real L_CC_interp() const;
-  
+
   //Chemical diffusivity matrix not symmetric
   Real DC_BB_interp() const;
   Real DC_BC_interp() const;
   Real DC_CB_interp() const;
   Real DC_CC_interp() const;
-  
+
   //Its first derivatives
   Real dL_BB_muB_interp() const;
   Real dL_BC_muB_interp() const;
   Real dL_CC_muB_interp() const;
-  
+
   Real dL_BB_muC_interp() const;
   Real dL_BC_muC_interp() const;
-  Real dL_CC_muC_interp() const; 
-  
-  //first derivative of the interpolation function
+  Real dL_CC_muC_interp() const;
+
+  //first derivative of the interpolation function w.r.t. phase field p
   //and sum over all phases
-  Real sum_dh_L_BB_alpha() const;
-  Real sum_dh_L_BB_beta()  const;
-  Real sum_dh_L_BB_gamma() const;
-  Real sum_dh_L_BB_delta() const;
-  Real sum_dh_L_BB_epsilon() const;
-  
-  Real sum_dh_L_BC_alpha() const;
-  Real sum_dh_L_BC_beta() const;
-  Real sum_dh_L_BC_gamma() const;
-  Real sum_dh_L_BC_delta() const;
-  Real sum_dh_L_BC_epsilon() const;
-    
-  Real sum_dh_L_CC_alpha() const;
-  Real sum_dh_L_CC_beta() const;
-  Real sum_dh_L_CC_gamma() const;
-  Real sum_dh_L_CC_delta() const;
-  Real sum_dh_L_CC_epsilon() const;
-  
+  Real sum_dh_L_BB(unsigned int p) const;
+  Real sum_dh_L_BC(unsigned int p) const;
+  Real sum_dh_L_CC(unsigned int p) const;
+
   //This base class requires three material property
   //1) The chi matrix of each phase of the system
   //2) The Onsager matrix of each phase
   //Based on this it constructs two derived material property
   //1) The interpolated thermodynamic factor matrix of the overall system
   //2) The interpolated diffusivity matrix of the overall system
-  
+
   //Note that the coeffecints of the susceptibility matrix are here referred
   // to as the inverse of the tf matrix.
   //First derivative xB with respect to comp B diffusion potential
-  const MaterialProperty<Real> & _inv_B_tf_alpha;
-  const MaterialProperty<Real> & _inv_B_tf_beta;
-  const MaterialProperty<Real> & _inv_B_tf_gamma;
-  const MaterialProperty<Real> & _inv_B_tf_delta; 
-  const MaterialProperty<Real> & _inv_B_tf_epsilon; 
-  
+  const PhaseProperties _inv_B_tf;
+
   //First derivative xB with respect to comp C diffusion potential
-  const MaterialProperty<Real> & _inv_BC_tf_alpha;
-  const MaterialProperty<Real> & _inv_BC_tf_beta;
-  const MaterialProperty<Real> & _inv_BC_tf_gamma;
-  const MaterialProperty<Real> & _inv_BC_tf_delta; 
-  const MaterialProperty<Real> & _inv_BC_tf_epsilon; 
-  
+  const PhaseProperties _inv_BC_tf;
+
   //First derivative xC with respect to comp C diffusion potential
-  const MaterialProperty<Real> & _inv_C_tf_alpha;
-  const MaterialProperty<Real> & _inv_C_tf_beta;
-  const MaterialProperty<Real> & _inv_C_tf_gamma;
-  const MaterialProperty<Real> & _inv_C_tf_delta; 
-  const MaterialProperty<Real> & _inv_C_tf_epsilon; 
-  
-  // All phase dependent material property L_BB
-  const MaterialProperty<Real>& _L_BB_alpha; 
-  const MaterialProperty<Real>& _L_BB_beta; 
-  const MaterialProperty<Real>& _L_BB_gamma;
-  const MaterialProperty<Real>& _L_BB_delta;
-  const MaterialProperty<Real>& _L_BB_epsilon;
-  
-  // All phase dependent material property L_BC
-  const MaterialProperty<Real>& _L_BC_alpha; 
-  const MaterialProperty<Real>& _L_BC_beta; 
-  const MaterialProperty<Real>& _L_BC_gamma;
-  const MaterialProperty<Real>& _L_BC_delta;
-  const MaterialProperty<Real>& _L_BC_epsilon;
-  
-  // All phase dependent material property L_CC
-  const MaterialProperty<Real>& _L_CC_alpha; 
-  const MaterialProperty<Real>& _L_CC_beta; 
-  const MaterialProperty<Real>& _L_CC_gamma;
-  const MaterialProperty<Real>& _L_CC_delta;
-  const MaterialProperty<Real>& _L_CC_epsilon;
-  
-  //To model the diffusion potential dependence of the Onsager mobility 
+  const PhaseProperties _inv_C_tf;
+
+  // All phase dependent material property L_BB, L_BC and L_CC
+  const PhaseProperties _L_BB;
+  const PhaseProperties _L_BC;
+  const PhaseProperties _L_CC;
+
+  //To model the diffusion potential dependence of the Onsager mobility
   //matrix this is required
 
   //***********************All derivatives with respect to B*****************/
-  //dL_BB_muB
-  const MaterialProperty<Real>& _dL_BB_muB_alpha;
-  const MaterialProperty<Real>& _dL_BB_muB_beta; 
-  const MaterialProperty<Real>& _dL_BB_muB_gamma;
-  const MaterialProperty<Real>& _dL_BB_muB_delta;
-  const MaterialProperty<Real>& _dL_BB_muB_epsilon;
-  
-  //dL_BC_muB
-  const MaterialProperty<Real>& _dL_BC_muB_alpha;
-  const MaterialProperty<Real>& _dL_BC_muB_beta; 
-  const MaterialProperty<Real>& _dL_BC_muB_gamma;
-  const MaterialProperty<Real>& _dL_BC_muB_delta;
-  const MaterialProperty<Real>& _dL_BC_muB_epsilon;  
- 
-  //dL_CC_muB
-  const MaterialProperty<Real>& _dL_CC_muB_alpha;
-  const MaterialProperty<Real>& _dL_CC_muB_beta; 
-  const MaterialProperty<Real>& _dL_CC_muB_gamma;
-  const MaterialProperty<Real>& _dL_CC_muB_delta;
-  const MaterialProperty<Real>& _dL_CC_muB_epsilon;
-   
+  const PhaseProperties _dL_BB_muB;
+  const PhaseProperties _dL_BC_muB;
+  const PhaseProperties _dL_CC_muB;
+
   //***********************All derivatives with respect to C*****************/
-  //dL_BB_muC
-  const MaterialProperty<Real>& _dL_BB_muC_alpha;
-  const MaterialProperty<Real>& _dL_BB_muC_beta; 
-  const MaterialProperty<Real>& _dL_BB_muC_gamma;
-  const MaterialProperty<Real>& _dL_BB_muC_delta;
-  const MaterialProperty<Real>& _dL_BB_muC_epsilon;
-  
-  //dL_BC_muC
-  const MaterialProperty<Real>& _dL_BC_muC_alpha;
-  const MaterialProperty<Real>& _dL_BC_muC_beta; 
-  const MaterialProperty<Real>& _dL_BC_muC_gamma;
-  const MaterialProperty<Real>& _dL_BC_muC_delta;
-  const MaterialProperty<Real>& _dL_BC_muC_epsilon;  
-  
-  //dL_CC_muC
-  const MaterialProperty<Real>& _dL_CC_muC_alpha;
-  const MaterialProperty<Real>& _dL_CC_muC_beta; 
-  const MaterialProperty<Real>& _dL_CC_muC_gamma;
-  const MaterialProperty<Real>& _dL_CC_muC_delta;
-  const MaterialProperty<Real>& _dL_CC_muC_epsilon;
- 
+  const PhaseProperties _dL_BB_muC;
+  const PhaseProperties _dL_BC_muC;
+  const PhaseProperties _dL_CC_muC;
+
+  //Matrices computed once per quadrature point by TernaryMultiPhaseDiffusivity,
+  //read by the functions above when precomputed_diffusivity is set
+  const bool _precomputed_diffusivity;
+  const MaterialProperty<RealTensorValue> * _chi_matrix;
+  const MaterialProperty<RealTensorValue> * _thermodynamic_factor_matrix;
+  const MaterialProperty<RealTensorValue> * _onsager_mobility_matrix;
+  const MaterialProperty<RealTensorValue> * _chemical_diffusivity_matrix;
+  std::vector<const MaterialProperty<RealTensorValue> *> _dL_dmu_matrix;
+  //Indexed by phase, null for the phases that are not coupled
+  std::vector<const MaterialProperty<RealTensorValue> *> _dL_dphi_matrix;
 };
+
+typedef TernaryMultiPhaseBaseTempl<5> TernaryMultiPhaseBase;
+
+template <>
+InputParameters validParams<TernaryMultiPhaseBase>();
+
+//The members of TernaryMultiPhaseBaseTempl used by the derived kernels
+#define usingTernaryMultiPhaseBaseMembers(P)                                                      \
+  usingMultiPhaseBaseMembers(P);                                                                  \
+  using TernaryMultiPhaseBaseTempl<P>::chi_BB;                                                    \
+  using TernaryMultiPhaseBaseTempl<P>::chi_BC;                                                    \
+  using TernaryMultiPhaseBaseTempl<P>::chi_CC;                                                    \
+  using TernaryMultiPhaseBaseTempl<P>::L_BB_interp;                                               \
+  using TernaryMultiPhaseBaseTempl<P>::L_BC_interp;                                               \
+  using TernaryMultiPhaseBaseTempl<P>::L_CC_interp;                                               \
+  using TernaryMultiPhaseBaseTempl<P>::DC_BB_interp;                                              \
+  using TernaryMultiPhaseBaseTempl<P>::DC_BC_interp;                                              \
+  using TernaryMultiPhaseBaseTempl<P>::DC_CB_interp;                                              \
+  using TernaryMultiPhaseBaseTempl<P>::DC_CC_interp;                                              \
+  using TernaryMultiPhaseBaseTempl<P>::dL_BB_muB_interp;                                          \
+  using TernaryMultiPhaseBaseTempl<P>::dL_BC_muB_interp;                                          \
+  using TernaryMultiPhaseBaseTempl<P>::dL_CC_muB_interp;                                          \
+  using TernaryMultiPhaseBaseTempl<P>::dL_BB_muC_interp;                                          \
+  using TernaryMultiPhaseBaseTempl<P>::dL_BC_muC_interp;                                          \
+  using TernaryMultiPhaseBaseTempl<P>::dL_CC_muC_interp;                                          \
+  using TernaryMultiPhaseBaseTempl<P>::sum_dh_L_BB;                                               \
+  using TernaryMultiPhaseBaseTempl<P>::sum_dh_L_BC;                                               \
+  using TernaryMultiPhaseBaseTempl<P>::sum_dh_L_CC
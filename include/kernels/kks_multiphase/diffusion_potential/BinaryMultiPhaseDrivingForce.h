@@ -15,6 +15,7 @@
 #pragma once
 
 #include "Kernel.h"
+#include "InterfaceBand.h"
 
 class BinaryMultiPhaseDrivingForce;
 
@@ -94,6 +95,13 @@ class BinaryMultiPhaseDrivingForce :  public Kernel
   
   //A non-dimensional parameter
   const MaterialProperty<Real> & _nd_factor;
+
+  //Whether the current element is away from the interfaces, where dh
+  //vanishes (see InterfaceBand)
+  bool inBulk() const { return _interface_band && _interface_band->isBulk(_current_elem); }
+
+  //Classification of the elements, if interface_band is given
+  const InterfaceBand * _interface_band;
     
 };
 //#endif // BINARYMULTIPHASEDRIVINGFORCE_H
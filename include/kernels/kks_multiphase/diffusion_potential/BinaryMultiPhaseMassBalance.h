@@ -7,125 +7,105 @@
 //* Licensed under LGPL 2.1, please see LICENSE for details
 //* https://www.gnu.org/licenses/lgpl-2.1.html
 
+
 #pragma once
 
 #include "Kernel.h"
+#include "MultiPhaseNames.h"
 
-class BinaryMultiPhaseMassBalance;
+#include <array>
 
-template <>
-InputParameters validParams<BinaryMultiPhaseMassBalance>();
+template <unsigned int P>
+class BinaryMultiPhaseMassBalanceTempl;
 
 /**
  * Kernel to implement the continuity
  * equation for mass conservation
  * variable on which this kernel operates: X
+ * The number of phases P is fixed at compile time, so the interpolated
+ * mobility and thermodynamic factor only sum the phases in use.
+ * h and dh are either scalar properties (h_alpha, dhbeta_dphialpha, ...)
+ * or the arrays of CompactQuantInterpolationFunction.
+ * Registered as BinaryTwoPhaseMassBalance, BinaryThreePhaseMassBalance and
+ * BinaryMultiPhaseMassBalance (five phases, the later three optional)
  */
-class BinaryMultiPhaseMassBalance: public Kernel
+template <unsigned int P>
+class BinaryMultiPhaseMassBalanceTempl: public Kernel
 {
 public:
-  BinaryMultiPhaseMassBalance(const InputParameters & parameters);
+  BinaryMultiPhaseMassBalanceTempl(const InputParameters & parameters);
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
+  //Checks the number of phases of CompactQuantInterpolationFunction
+  virtual void initialSetup() override;
+
 
   //Declare constant memeber functon
   Real thermodynamic_factor() const;
   Real L_BB_interp() const;
   Real dL_BB_muB_interp() const;
- 
-  const VariableValue & _phase_alpha;
-  unsigned int _phase_alpha_var;
-  
-  const VariableValue & _phase_beta;
-  unsigned int _phase_beta_var;
-  
-  const VariableValue & _phase_gamma;
-  unsigned int _phase_gamma_var;
-  
-  const VariableValue & _phase_delta;
-  unsigned int _phase_delta_var;
-  
-  const VariableValue & _phase_epsilon;
-  unsigned int _phase_epsilon_var;
-  
+
+  //Interpolation function of phase p and its derivative w.r.t. phase field
+  //p of phase q, read from CompactQuantInterpolationFunction if
+  //compact_interpolation is set
+  Real h(unsigned int p) const
+  {
+    return _compact_h ? (*_compact_h)[_qp][p] : (*_h[p])[_qp];
+  }
+  Real dh(unsigned int q, unsigned int p) const
+  {
+    return _compact_dh ? (*_compact_dh)[_qp][q * (*_compact_h)[_qp].size() + p]
+                       : (*_dh[q][p])[_qp];
+  }
+
+  //Phase field variables
+  std::array<unsigned int, P> _phase_var;
+
   const VariableGradient & _grad_B_diff_pot;
   unsigned int _B_diff_pot_var;
-  
+
   //First derivative with respect to diffusion potential
-  const MaterialProperty<Real> & _inv_B_tf_alpha;
-  const MaterialProperty<Real> & _inv_B_tf_beta;
-  const MaterialProperty<Real> & _inv_B_tf_gamma;
-  const MaterialProperty<Real> & _inv_B_tf_delta; 
-  const MaterialProperty<Real> & _inv_B_tf_epsilon; 
-    
-  std::string _h_alpha_name, _h_beta_name, 
-              _h_gamma_name, _h_delta_name, _h_epsilon_name;
-  
+  std::array<const MaterialProperty<Real> *, P> _inv_B_tf;
+
   //_h_alpha, _h_beta....
-  const MaterialProperty<Real>& _h_alpha;
-  const MaterialProperty<Real>& _h_beta;
-  const MaterialProperty<Real>& _h_gamma;
-  const MaterialProperty<Real>& _h_delta;
-  const MaterialProperty<Real>& _h_epsilon;
-  
-  //First derivatives of the interpolation function for phase alpha_var
-  const MaterialProperty<Real>& _dhbeta_dphialpha;
-  const MaterialProperty<Real>& _dhgamma_dphialpha;
-  const MaterialProperty<Real>& _dhdelta_dphialpha;
-  const MaterialProperty<Real>& _dhepsilon_dphialpha;
-  
-  //First derivatives of the interpolation function for phase beta_var
-  const MaterialProperty<Real>& _dhalpha_dphibeta;
-  const MaterialProperty<Real>& _dhgamma_dphibeta;
-  const MaterialProperty<Real>& _dhdelta_dphibeta;
-  const MaterialProperty<Real>& _dhepsilon_dphibeta;
-  
-  //First derivatives of the interpolation function for phase gamma_var
-  const MaterialProperty<Real>& _dhalpha_dphigamma;
-  const MaterialProperty<Real>& _dhbeta_dphigamma;
-  const MaterialProperty<Real>& _dhdelta_dphigamma;
-  const MaterialProperty<Real>& _dhepsilon_dphigamma;
-  
-  //First derivatives of the interpolation function for phase delta_var
-  const MaterialProperty<Real>& _dhalpha_dphidelta;
-  const MaterialProperty<Real>& _dhbeta_dphidelta;
-  const MaterialProperty<Real>& _dhgamma_dphidelta;
-  const MaterialProperty<Real>& _dhepsilon_dphidelta;
-  
-  //First derivatives of the interpolation function for phase epsilon_var
-  const MaterialProperty<Real>& _dhalpha_dphiepsilon;
-  const MaterialProperty<Real>& _dhbeta_dphiepsilon;
-  const MaterialProperty<Real>& _dhgamma_dphiepsilon;
-  const MaterialProperty<Real>& _dhdelta_dphiepsilon;
-  
+  std::array<const MaterialProperty<Real> *, P> _h;
+
+  //First derivatives of the interpolation functions: _dh[q][p] is the
+  //derivative of h_q w.r.t. phase field p (null for q == p)
+  std::array<std::array<const MaterialProperty<Real> *, P>, P> _dh;
+
   // Isotropic Onsager mobility dependent on diffusion potential
-  const MaterialProperty<Real>& _L_BB_alpha; 
-  const MaterialProperty<Real>& _L_BB_beta; 
-  const MaterialProperty<Real>& _L_BB_gamma;
-  const MaterialProperty<Real>& _L_BB_delta;
-  const MaterialProperty<Real>& _L_BB_epsilon;
- 
-  const MaterialProperty<Real>& _dL_BB_muB_alpha;
-  const MaterialProperty<Real>& _dL_BB_muB_beta; 
-  const MaterialProperty<Real>& _dL_BB_muB_gamma;
-  const MaterialProperty<Real>& _dL_BB_muB_delta;
-  const MaterialProperty<Real>& _dL_BB_muB_epsilon; 
-  
+  std::array<const MaterialProperty<Real> *, P> _L_BB;
+  std::array<const MaterialProperty<Real> *, P> _dL_BB_muB;
+
+  //Prefix of the properties of CompactQuantInterpolationFunction
+  const std::string _interpolation_base_name;
+
+  //Properties of CompactQuantInterpolationFunction (null if not used)
+  const MaterialProperty<std::vector<Real>> * _compact_h;
+  const MaterialProperty<std::vector<Real>> * _compact_dh;
+
 private:
   //This is not required if the thermodynamic factor is a constant
   //Also, note that else the kernel will return (1/0) !
   //Real third_deriv() const;
-  
+
   //Second derivative of composition with respect to diffusion potential
-  //const MaterialProperty<Real>& _inv_B_td_alpha; 
-  //const MaterialProperty<Real>& _inv_B_td_beta;
-  //const MaterialProperty<Real>& _inv_B_td_gamma;
-  //const MaterialProperty<Real>& _inv_B_td_delta;
-  //const MaterialProperty<Real>& _inv_B_td_epsilon;
-  
+  //(inv_B_td_alpha, inv_B_td_beta, ...)
 };
+
+typedef BinaryMultiPhaseMassBalanceTempl<2> BinaryTwoPhaseMassBalance;
+typedef BinaryMultiPhaseMassBalanceTempl<3> BinaryThreePhaseMassBalance;
+typedef BinaryMultiPhaseMassBalanceTempl<5> BinaryMultiPhaseMassBalance;
+
+template <>
+InputParameters validParams<BinaryTwoPhaseMassBalance>();
+template <>
+InputParameters validParams<BinaryThreePhaseMassBalance>();
+template <>
+InputParameters validParams<BinaryMultiPhaseMassBalance>();
 //#endif // BINARYMULTIPHASEMASSBALANCE_H
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "ACBulk.h"
+#include "InterfaceBand.h"
 
 class GBinaryMultiPhaseDrivingForce;
 
@@ -82,5 +83,12 @@ class GBinaryMultiPhaseDrivingForce :  public ACBulk<Real>
     const MaterialProperty<Real> & _d2h_5;
     
     //A non-dimensional parameter
-    const MaterialProperty<Real> & _nd_factor;   
+    const MaterialProperty<Real> & _nd_factor;
+
+    //Whether the current element is away from the interfaces, where dh
+    //vanishes (see InterfaceBand)
+    bool inBulk() const { return _interface_band && _interface_band->isBulk(_current_elem); }
+
+    //Classification of the elements, if interface_band is given
+    const InterfaceBand * _interface_band;
 };
@@ -9,86 +9,111 @@
 
 #pragma once
 #include "Kernel.h"
+#include "InterfaceBand.h"
+#include "MultiPhaseNames.h"
 
-class MultiPhaseBase;
+#include <array>
 
-template <>
-InputParameters validParams<MultiPhaseBase>();
+template <unsigned int P>
+class MultiPhaseBaseTempl;
+
+//Parameters of the phases of a kernel with num_phases phases. The five-phase
+//kernels keep the parameters of the former MultiPhaseBase: their last three
+//phases are optional and their properties default to zero.
+InputParameters multiPhaseBaseParams(unsigned int num_phases);
+
+//Adds the parameters <prefix><phase> of the optional phases (see above),
+//which default to zero; the other phases read the property <prefix><phase>
+void addOptionalPhaseProperty(InputParameters & params,
+                              unsigned int num_phases,
+                              const std::string & prefix,
+                              const std::string & description);
 
 /**
  * This kernel is the base class for multiphase system
  * Later this can be inherited by binary, ternary, and quarternary systems
  * equation for mass conservation
  * variable on which this kernel operates: X
+ * The number of phases P is fixed at compile time, so the sums over
+ * the phases only run over the phases in use.
+ * Registered as MultiPhaseBase (five phases, the later three optional)
  */
-class MultiPhaseBase: public Kernel
+template <unsigned int P>
+class MultiPhaseBaseTempl : public Kernel
 {
 public:
-  MultiPhaseBase(const InputParameters & parameters);
+  MultiPhaseBaseTempl(const InputParameters & parameters);
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
-  
-  //All phases for any multi-phase system
-  //Here, we have assumed 5 phases;
-  //It can be extended to N..phases;
- 
-  const VariableValue & _phase_alpha;
-  unsigned int _phase_alpha_var;
-  
-  const VariableValue & _phase_beta;
-  unsigned int _phase_beta_var;
-  
-  const VariableValue & _phase_gamma;
-  unsigned int _phase_gamma_var;
-  
-  const VariableValue & _phase_delta;
-  unsigned int _phase_delta_var;
-  
-  const VariableValue & _phase_epsilon;
-  unsigned int _phase_epsilon_var;
- 
-
-  std::string _h_alpha_name, _h_beta_name, 
-              _h_gamma_name, _h_delta_name, _h_epsilon_name;
-  
-  //_h_alpha, _h_beta....
-  const MaterialProperty<Real>& _h_alpha;
-  const MaterialProperty<Real>& _h_beta;
-  const MaterialProperty<Real>& _h_gamma;
-  const MaterialProperty<Real>& _h_delta;
-  const MaterialProperty<Real>& _h_epsilon;
-  
-  //First derivatives of the interpolation function for phase alpha_var
-  const MaterialProperty<Real>& _dhbeta_dphialpha;
-  const MaterialProperty<Real>& _dhgamma_dphialpha;
-  const MaterialProperty<Real>& _dhdelta_dphialpha;
-  const MaterialProperty<Real>& _dhepsilon_dphialpha;
-  
-  //First derivatives of the interpolation function for phase beta_var
-  const MaterialProperty<Real>& _dhalpha_dphibeta;
-  const MaterialProperty<Real>& _dhgamma_dphibeta;
-  const MaterialProperty<Real>& _dhdelta_dphibeta;
-  const MaterialProperty<Real>& _dhepsilon_dphibeta;
-  
-  //First derivatives of the interpolation function for phase gamma_var
-  const MaterialProperty<Real>& _dhalpha_dphigamma;
-  const MaterialProperty<Real>& _dhbeta_dphigamma;
-  const MaterialProperty<Real>& _dhdelta_dphigamma;
-  const MaterialProperty<Real>& _dhepsilon_dphigamma;
-  
-  //First derivatives of the interpolation function for phase delta_var
-  const MaterialProperty<Real>& _dhalpha_dphidelta;
-  const MaterialProperty<Real>& _dhbeta_dphidelta;
-  const MaterialProperty<Real>& _dhgamma_dphidelta;
-  const MaterialProperty<Real>& _dhepsilon_dphidelta;
-  
-  //First derivatives of the interpolation function for phase epsilon_var
-  const MaterialProperty<Real>& _dhalpha_dphiepsilon;
-  const MaterialProperty<Real>& _dhbeta_dphiepsilon;
-  const MaterialProperty<Real>& _dhgamma_dphiepsilon;
-  const MaterialProperty<Real>& _dhdelta_dphiepsilon;
-  
+
+  typedef std::array<const MaterialProperty<Real> *, P> PhaseProperties;
+
+  //Whether the current element is away from the interfaces, where the
+  //derivatives of the interpolation functions vanish (see InterfaceBand)
+  bool inBulk() const { return _interface_band && _interface_band->isBulk(_current_elem); }
+
+  //Phase whose phase field is jvar, P if jvar is not a phase field
+  unsigned int phaseIndex(unsigned int jvar) const;
+
+  //Whether jvar is one of the phase fields
+  bool isPhaseVar(unsigned int jvar) const { return phaseIndex(jvar) < P; }
+
+  //Interpolation function of phase p and its derivative w.r.t. phase field
+  //p of phase q
+  Real h(unsigned int p) const { return (*_h[p])[_qp]; }
+  Real dh(unsigned int q, unsigned int p) const { return (*_dh[q][p])[_qp]; }
+
+  //Properties <prefix><phase> of all the phases
+  PhaseProperties phaseProperties(const std::string & prefix);
+
+  //sum_p h_p * prop_p
+  Real interpolate(const PhaseProperties & prop) const;
+
+  //Derivative of the above w.r.t. phase field p:
+  //sum_{q != p} dh_q/dphi_p * (prop_q - prop_p)
+  Real sumDh(const PhaseProperties & prop, unsigned int p) const;
+
+  //Phase field variables
+  std::array<unsigned int, P> _phase_var;
+
+  //Interpolation function of each phase
+  PhaseProperties _h;
+
+  //_dh[q][p] is the derivative of h_q w.r.t. phase field p
+  //(null for q == p)
+  std::array<PhaseProperties, P> _dh;
+
+  //Classification of the elements, if interface_band is given
+  const InterfaceBand * _interface_band;
 };
+
+typedef MultiPhaseBaseTempl<5> MultiPhaseBase;
+
+template <>
+InputParameters validParams<MultiPhaseBase>();
+
+//The members of MultiPhaseBaseTempl used by the kernels templated on P
+#define usingMultiPhaseBaseMembers(P)                                                             \
+  using typename MultiPhaseBaseTempl<P>::PhaseProperties;                                         \
+  using MultiPhaseBaseTempl<P>::_qp;                                                              \
+  using MultiPhaseBaseTempl<P>::_i;                                                               \
+  using MultiPhaseBaseTempl<P>::_j;                                                               \
+  using MultiPhaseBaseTempl<P>::_test;                                                            \
+  using MultiPhaseBaseTempl<P>::_grad_test;                                                       \
+  using MultiPhaseBaseTempl<P>::_phi;                                                             \
+  using MultiPhaseBaseTempl<P>::_grad_phi;                                                        \
+  using MultiPhaseBaseTempl<P>::coupled;                                                          \
+  using MultiPhaseBaseTempl<P>::coupledValue;                                                     \
+  using MultiPhaseBaseTempl<P>::coupledGradient;                                                  \
+  using MultiPhaseBaseTempl<P>::isCoupled;                                                        \
+  using MultiPhaseBaseTempl<P>::inBulk;                                                           \
+  using MultiPhaseBaseTempl<P>::phaseIndex;                                                       \
+  using MultiPhaseBaseTempl<P>::isPhaseVar;                                                       \
+  using MultiPhaseBaseTempl<P>::h;                                                                \
+  using MultiPhaseBaseTempl<P>::dh;                                                               \
+  using MultiPhaseBaseTempl<P>::phaseProperties;                                                  \
+  using MultiPhaseBaseTempl<P>::interpolate;                                                      \
+  using MultiPhaseBaseTempl<P>::sumDh
@@ -7,98 +7,96 @@
 //* Licensed under LGPL 2.1, please see LICENSE for details
 //* https://www.gnu.org/licenses/lgpl-2.1.html
 
+
 //#ifndef MULTIPHASECONSTRAINTMU_H
 //#define MULTIPHASECONSTRAINTMU_H
 
 #pragma once
 
 #include "Kernel.h"
+#include "MultiPhaseNames.h"
 
-// Forward declaration
-class MultiPhaseConstraintMu;
+#include <array>
 
-//class template specialization:
-template <>
-InputParameters validParams<MultiPhaseConstraintMu>();
+// Forward declaration
+template <unsigned int P>
+class MultiPhaseConstraintMuTempl;
 
 /**
  * This class enforces the equation for mole fraction
  * c = c_{alpha}* h_alpha + c_{beta}* h_beta + c_{gamma} * h_gamma
  * The class is a derived class from base class kernel
+ * The number of phases P is fixed at compile time, so the sums over
+ * the phases only run over the phases in use.
+ * h and dh are either scalar properties (h_alpha, dhbeta_dphialpha, ...)
+ * or the arrays of CompactQuantInterpolationFunction.
+ * Registered as TwoPhaseConstraintMu, ThreePhaseConstraintMu and
+ * MultiPhaseConstraintMu (five phases, the later three optional)
  **/
-class MultiPhaseConstraintMu : public Kernel
+template <unsigned int P>
+class MultiPhaseConstraintMuTempl : public Kernel
 {
 public:
-   MultiPhaseConstraintMu(const InputParameters & parameters);
+   MultiPhaseConstraintMuTempl(const InputParameters & parameters);
 
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned jvar) override;
-       
-     
-  const VariableValue & _phase_alpha;
-  unsigned int _phase_alpha_var;
-  
-  const VariableValue & _phase_beta;
-  unsigned int _phase_beta_var;
-  
-  const VariableValue & _phase_gamma;
-  unsigned int _phase_gamma_var;
-  
-  const VariableValue & _phase_delta;
-  unsigned int _phase_delta_var;
-  
-  const VariableValue & _phase_epsilon;
-  unsigned int _phase_epsilon_var;
-          
-  const MaterialProperty<Real> & _h_alpha;
-  const MaterialProperty<Real> & _h_beta;
-  const MaterialProperty<Real> & _h_gamma;
-  const MaterialProperty<Real> & _h_delta;
-  const MaterialProperty<Real> & _h_epsilon;    
-                
-  const MaterialProperty<Real> & _dhbeta_dphialpha;
-  const MaterialProperty<Real> & _dhgamma_dphialpha;
-  const MaterialProperty<Real> & _dhdelta_dphialpha;
-  const MaterialProperty<Real> & _dhepsilon_dphialpha; 
-        
-  const MaterialProperty<Real> & _dhalpha_dphibeta;
-  const MaterialProperty<Real> & _dhgamma_dphibeta;
-  const MaterialProperty<Real> & _dhdelta_dphibeta;
-  const MaterialProperty<Real> & _dhepsilon_dphibeta;
-        
-  const MaterialProperty<Real> & _dhalpha_dphigamma;
-  const MaterialProperty<Real> & _dhbeta_dphigamma;
-  const MaterialProperty<Real> & _dhdelta_dphigamma;
-  const MaterialProperty<Real> & _dhepsilon_dphigamma;
-  
-  const MaterialProperty<Real> & _dhalpha_dphidelta;
-  const MaterialProperty<Real> & _dhbeta_dphidelta;
-  const MaterialProperty<Real> & _dhgamma_dphidelta;
-  const MaterialProperty<Real> & _dhepsilon_dphidelta;
-  
-  const MaterialProperty<Real> & _dhalpha_dphiepsilon;
-  const MaterialProperty<Real> & _dhbeta_dphiepsilon;
-  const MaterialProperty<Real> & _dhgamma_dphiepsilon;
-  const MaterialProperty<Real> & _dhdelta_dphiepsilon; 
-  
+
+  //Checks the number of phases of CompactQuantInterpolationFunction
+  virtual void initialSetup() override;
+
+  //Interpolation function of phase p and its derivative w.r.t. phase field
+  //p of phase q, read from CompactQuantInterpolationFunction if
+  //compact_interpolation is set
+  Real h(unsigned int p) const
+  {
+    return _compact_h ? (*_compact_h)[_qp][p] : (*_h[p])[_qp];
+  }
+  Real dh(unsigned int q, unsigned int p) const
+  {
+    return _compact_dh ? (*_compact_dh)[_qp][q * (*_compact_h)[_qp].size() + p]
+                       : (*_dh[q][p])[_qp];
+  }
+
+  //Phase field variables
+  std::array<unsigned int, P> _phase_var;
+
+  //Interpolation function of each phase
+  std::array<const MaterialProperty<Real> *, P> _h;
+
+  //_dh[q][p] is the derivative of h_q w.r.t. phase field p
+  //Note: Only non-diagonal components of the interpolation marix
+  //are required (null for q == p)
+  std::array<std::array<const MaterialProperty<Real> *, P>, P> _dh;
+
   const VariableValue & _xB;
   unsigned int _xB_var;
-  
+
   //phase comp material property for each phase
-  const MaterialProperty<Real> & _xB_alpha;
-  const MaterialProperty<Real> & _xB_beta;
-  const MaterialProperty<Real> & _xB_gamma;
-  const MaterialProperty<Real> & _xB_delta;
-  const MaterialProperty<Real> & _xB_epsilon;
-   
+  std::array<const MaterialProperty<Real> *, P> _xB_phase;
+
   //First derivative with respect to diffusion potential
-  const MaterialProperty<Real> & _inv_B_tf_alpha;
-  const MaterialProperty<Real> & _inv_B_tf_beta;
-  const MaterialProperty<Real> & _inv_B_tf_gamma;
-  const MaterialProperty<Real> & _inv_B_tf_delta;
-  const MaterialProperty<Real> & _inv_B_tf_epsilon;
-    
+  std::array<const MaterialProperty<Real> *, P> _inv_B_tf;
+
+  //Prefix of the properties of CompactQuantInterpolationFunction
+  const std::string _interpolation_base_name;
+
+  //Properties of CompactQuantInterpolationFunction (null if not used)
+  const MaterialProperty<std::vector<Real>> * _compact_h;
+  const MaterialProperty<std::vector<Real>> * _compact_dh;
 };
+
+typedef MultiPhaseConstraintMuTempl<2> TwoPhaseConstraintMu;
+typedef MultiPhaseConstraintMuTempl<3> ThreePhaseConstraintMu;
+typedef MultiPhaseConstraintMuTempl<5> MultiPhaseConstraintMu;
+
+//class template specialization:
+template <>
+InputParameters validParams<TwoPhaseConstraintMu>();
+template <>
+InputParameters validParams<ThreePhaseConstraintMu>();
+template <>
+InputParameters validParams<MultiPhaseConstraintMu>();
 //#endif // MULTIPHASECONSTRAINTMU_H
@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+#include <string>
+
+//Phases of the multiphase kernels, in the order of their phase fields.
+//A kernel with P phases couples phase_<name> of the first P of them and
+//reads the properties of each phase with the name as suffix (h_alpha,
+//xB_alpha, dhbeta_dphialpha, ...).
+namespace MultiPhaseNames
+{
+const unsigned int max_phases = 5;
+
+inline const std::string &
+phase(unsigned int p)
+{
+  static const std::string names[max_phases] = {"alpha", "beta", "gamma", "delta", "epsilon"};
+  return names[p];
+}
+
+//Name of the derivative of h_q w.r.t. phase field p
+inline std::string
+dhName(unsigned int q, unsigned int p)
+{
+  return "dh" + phase(q) + "_dphi" + phase(p);
+}
+}
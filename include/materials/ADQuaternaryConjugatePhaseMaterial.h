@@ -0,0 +1,66 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+//MOOSE includes
+#include "TabulatedPhaseMaterial.h"
+#include "QuaternaryConjugatePhaseData.h"
+
+/**
+ * AD version of QuaternaryConjugatePhaseMaterial: the mole fractions of B,
+ * C and D are dual numbers whose derivatives w.r.t. the diffusion
+ * potentials are the tabulated inverse thermodynamic factors, and the
+ * chemical potential of A has the derivatives -x_k w.r.t. the diffusion
+ * potential of k. The inverse thermodynamic factors are returned as AD
+ * properties without derivatives (those are not tabulated).
+ */
+class ADQuaternaryConjugatePhaseMaterial : public TabulatedPhaseMaterial
+{
+public:
+  static InputParameters validParams();
+
+  ADQuaternaryConjugatePhaseMaterial(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+private:
+  //Chemical potential of comp A
+  ADMaterialProperty<Real> & _A_chem_pot_val;
+
+  //Mole fractions of comp B, C and D
+  ADMaterialProperty<Real> & _xB_val;
+  ADMaterialProperty<Real> & _xC_val;
+  ADMaterialProperty<Real> & _xD_val;
+
+  //Inverse thermodynamic factors w.r.t B, C, D, BC, BD and CD
+  ADMaterialProperty<Real> & _inv_B_tf_val;
+  ADMaterialProperty<Real> & _inv_C_tf_val;
+  ADMaterialProperty<Real> & _inv_D_tf_val;
+  ADMaterialProperty<Real> & _inv_BC_tf_val;
+  ADMaterialProperty<Real> & _inv_BD_tf_val;
+  ADMaterialProperty<Real> & _inv_CD_tf_val;
+
+  //Independent variables on which the properties depend
+  const ADVariableValue & _B_diff_pot;
+  const ADVariableValue & _C_diff_pot;
+  const ADVariableValue & _D_diff_pot;
+
+  //Table of the properties of the phase
+  const QuaternaryConjugatePhaseData & _table_object;
+
+  //Values of the diffusion potentials and of the table at the quadrature
+  //points of the element
+  std::vector<Real> _muB, _muC, _muD;
+  std::vector<Real> _values;
+};
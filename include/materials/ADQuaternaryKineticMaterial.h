@@ -0,0 +1,68 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+//MOOSE includes
+#include "TabulatedKineticMaterial.h"
+#include "QuaternaryMobilityData.h"
+#include "QuaternaryConjugateMobilityData.h"
+
+#include <array>
+
+// Forward Declarations
+template <typename T>
+class ADQuaternaryKineticMaterialTempl;
+
+/**
+ * AD version of QuaternaryKineticMaterial and QuaternaryConjugateKineticMaterial:
+ * the Onsager mobilities L_BB, L_CC, L_DD, L_BC, L_BD and L_CD are dual
+ * numbers whose derivatives w.r.t. the three coupled variables (the mole
+ * fractions xB, xC, xD or the diffusion potentials B_diff_pot, C_diff_pot,
+ * D_diff_pot) are the tabulated derivatives of the mobilities.
+ * Registered as ADQuaternaryKineticMaterial and ADQuaternaryConjugateKineticMaterial.
+ */
+template <typename T>
+class ADQuaternaryKineticMaterialTempl : public TabulatedKineticMaterial
+{
+public:
+  static InputParameters validParams();
+
+  ADQuaternaryKineticMaterialTempl(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+  //Names of the mobilities, in the order of the table, and of the
+  //coupled variables
+  static const std::array<std::string, 6> & mobilityNames();
+  static const std::array<std::string, 3> & variableNames();
+
+private:
+  //Onsager mobilities
+  std::array<ADMaterialProperty<Real> *, 6> _L;
+
+  //Independent variables on which the mobilities depend
+  std::array<const ADVariableValue *, 3> _var;
+
+  //Table of the mobilities of the phase and their derivatives
+  const T & _table_object;
+
+  //Values of the variables and of the table at the quadrature points of
+  //the element
+  std::array<std::vector<Real>, 3> _var_values;
+  std::vector<Real> _values;
+};
+
+typedef ADQuaternaryKineticMaterialTempl<QuaternaryMobilityData> ADQuaternaryKineticMaterial;
+typedef ADQuaternaryKineticMaterialTempl<QuaternaryConjugateMobilityData>
+    ADQuaternaryConjugateKineticMaterial;
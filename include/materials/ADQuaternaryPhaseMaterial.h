@@ -0,0 +1,63 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+//MOOSE includes
+#include "TabulatedPhaseMaterial.h"
+#include "QuaternaryPhaseData.h"
+
+/**
+ * AD version of QuaternaryPhaseMaterial: the diffusion potentials of B, C
+ * and D are dual numbers whose derivatives w.r.t. the mole fractions are
+ * the tabulated thermodynamic factors, so that the kernels using them get
+ * an exact Jacobian. The thermodynamic factors are returned as AD
+ * properties without derivatives (those would need the third derivatives
+ * of the free energy, which are not tabulated).
+ */
+class ADQuaternaryPhaseMaterial : public TabulatedPhaseMaterial
+{
+public:
+  static InputParameters validParams();
+
+  ADQuaternaryPhaseMaterial(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+private:
+  //Diffusion potentials of comp B, C and D
+  ADMaterialProperty<Real> & _B_diff_pot_val;
+  ADMaterialProperty<Real> & _C_diff_pot_val;
+  ADMaterialProperty<Real> & _D_diff_pot_val;
+
+  //Thermodynamic factors w.r.t B, C, D, BC, BD and CD
+  ADMaterialProperty<Real> & _B_therm_factor_val;
+  ADMaterialProperty<Real> & _C_therm_factor_val;
+  ADMaterialProperty<Real> & _D_therm_factor_val;
+  ADMaterialProperty<Real> & _BC_therm_factor_val;
+  ADMaterialProperty<Real> & _BD_therm_factor_val;
+  ADMaterialProperty<Real> & _CD_therm_factor_val;
+
+  //Independent variables on which the properties depend
+  const ADVariableValue & _mol_fraction_B;
+  const ADVariableValue & _mol_fraction_C;
+  const ADVariableValue & _mol_fraction_D;
+
+  //Table of the properties of the phase
+  const QuaternaryPhaseData & _table_object;
+
+  //Values of the mole fractions and of the table at the quadrature points
+  //of the element
+  std::vector<Real> _xB, _xC, _xD;
+  std::vector<Real> _values;
+};
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class ArrayConjugateKineticMaterial;
+
+//MOOSE includes
+#include "TabulatedKineticMaterial.h"
+#include "TernaryConjugateMobilityData.h"
+#include "QuaternaryConjugateMobilityData.h"
+
+template <>
+InputParameters validParams<ArrayConjugateKineticMaterial>();
+
+/**
+ * Tabulated Onsager mobilities of a phase of a ternary or quaternary alloy
+ * and their derivatives as functions of the array variable of the diffusion
+ * potentials (B, C[, D]), the kinetic counterpart of
+ * ArrayConjugatePhaseMaterial. The number of components of the array selects
+ * the table object (TernaryConjugateMobilityData or
+ * QuaternaryConjugateMobilityData), and the properties are declared under the
+ * names read by Ternary/QuaternaryMultiPhaseDiffusivity, e.g. L_BC_alpha and
+ * dL_BC_muB_alpha for phase = alpha.
+ */
+class ArrayConjugateKineticMaterial : public TabulatedKineticMaterial
+{
+public:
+  ArrayConjugateKineticMaterial(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+private:
+  //Diffusion potentials of the independent components
+  const ArrayVariableValue & _diff_pot;
+
+  //Number of independent components, 2 (ternary) or 3 (quaternary)
+  const unsigned int _count;
+
+  //Mobility table of the phase, the one matching _count is set
+  const TernaryConjugateMobilityData * _ternary_table;
+  const QuaternaryConjugateMobilityData * _quaternary_table;
+
+  //Declared properties in the order of the enum Property of the table
+  std::vector<MaterialProperty<Real> *> _properties;
+
+  //Diffusion potential of each component at the quadrature points
+  std::vector<std::vector<Real>> _diff_pot_qp;
+
+  //Values of the table at the quadrature points of the element
+  std::vector<Real> _values;
+};
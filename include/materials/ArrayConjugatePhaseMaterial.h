@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class ArrayConjugatePhaseMaterial;
+
+//MOOSE includes
+#include "TabulatedPhaseMaterial.h"
+#include "TernaryConjugatePhaseData.h"
+#include "QuaternaryConjugatePhaseData.h"
+
+template <>
+InputParameters validParams<ArrayConjugatePhaseMaterial>();
+
+/**
+ * Tabulated properties of a phase of a ternary or quaternary alloy as
+ * functions of the array variable of the diffusion potentials (B, C[, D]),
+ * as used by ArrayMCContinuityEquation and ArrayMCPhaseConstraintMu.
+ * The number of components of the array selects the table object
+ * (TernaryConjugatePhaseData or QuaternaryConjugatePhaseData), and the
+ * properties are declared under the names read by the multiphase kernels
+ * and by Ternary/QuaternaryMultiPhaseDiffusivity, e.g. xB_alpha,
+ * inv_BC_tf_alpha and A_chem_pot_alpha for phase = alpha.
+ */
+class ArrayConjugatePhaseMaterial : public TabulatedPhaseMaterial
+{
+public:
+  ArrayConjugatePhaseMaterial(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+private:
+  //Diffusion potentials of the independent components
+  const ArrayVariableValue & _diff_pot;
+
+  //Number of independent components, 2 (ternary) or 3 (quaternary)
+  const unsigned int _count;
+
+  //Table of the phase, the one matching _count is set
+  const TernaryConjugatePhaseData * _ternary_table;
+  const QuaternaryConjugatePhaseData * _quaternary_table;
+
+  //Declared properties in the order of the enum Property of the table
+  std::vector<MaterialProperty<Real> *> _properties;
+
+  //Diffusion potential of each component at the quadrature points
+  std::vector<std::vector<Real>> _diff_pot_qp;
+
+  //Values of the table at the quadrature points of the element
+  std::vector<Real> _values;
+};
@@ -0,0 +1,92 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//Forward Declarations
+template <unsigned int N>
+class MultiPhaseDiffusivity;
+
+//MOOSE includes
+#include "Material.h"
+
+//MultiPhaseDiffusivity computes, once per quadrature point, the matrices of
+//an alloy with N independent components (B, C[, D]) and up to five phases
+//that the continuity and phase constraint kernels (see TernaryMultiPhaseBase
+//and MultiCompMultiPhaseBase) otherwise rebuild for every pair of test and
+//trial functions. Rows and columns are ordered B, C, D; the matrices of a
+//ternary alloy only use the first two.
+//  chi                   sum of h_p * inverse thermodynamic factor of phase p
+//  thermodynamic_factor  inverse of chi
+//  onsager_mobility      sum of h_p * L_p
+//  chemical_diffusivity  onsager_mobility * thermodynamic_factor
+//  dL_dmuX               sum of h_p * dL_p/dmuX, for each component X
+//  dL_dphi_p             derivative of onsager_mobility w.r.t. phase field p
+//The phase properties are named as in the kernels. The phases present are
+//alpha, beta and the following ones whose h_ is given; only their
+//properties are read and their dL_dphi declared.
+//Registered as TernaryMultiPhaseDiffusivity and QuaternaryMultiPhaseDiffusivity.
+
+class MultiPhaseDiffusivityBase
+{
+public:
+  //Phases and independent components, in the order of the matrices
+  static const std::vector<std::string> phases;
+  static const std::vector<std::string> components;
+};
+
+template <unsigned int N>
+class MultiPhaseDiffusivity : public Material, public MultiPhaseDiffusivityBase
+{
+public:
+  MultiPhaseDiffusivity(const InputParameters & parameters);
+
+  //Number of distinct coefficients of the symmetric matrices
+  static const unsigned int num_coeffs = N * (N + 1) / 2;
+
+  //Row and column of each distinct coefficient, row by row
+  static const unsigned int coeff_row[num_coeffs];
+  static const unsigned int coeff_col[num_coeffs];
+
+protected:
+  virtual void computeQpProperties() override;
+
+  //Name of a property declared by this material
+  std::string propertyName(const std::string & name) const;
+
+  //Copy the upper triangle of a symmetric matrix to its lower triangle
+  static void symmetrize(RealTensorValue & matrix);
+
+  const std::string _base_name;
+
+  //Number of phases present (2 to 5, see phases)
+  unsigned int _num_phases;
+
+  //Properties of each phase: [phase][coefficient]
+  std::vector<std::vector<const MaterialProperty<Real> *>> _inv_tf;
+  std::vector<std::vector<const MaterialProperty<Real> *>> _L;
+
+  //Derivatives of the mobilities: [component][phase][coefficient]
+  std::vector<std::vector<std::vector<const MaterialProperty<Real> *>>> _dL;
+
+  //Interpolation functions and their derivatives: _dh[p][q] is the
+  //derivative of h_p w.r.t. phase field q (null for p == q)
+  std::vector<const MaterialProperty<Real> *> _h;
+  std::vector<std::vector<const MaterialProperty<Real> *>> _dh;
+
+  MaterialProperty<RealTensorValue> & _chi;
+  MaterialProperty<RealTensorValue> & _thermodynamic_factor;
+  MaterialProperty<RealTensorValue> & _onsager_mobility;
+  MaterialProperty<RealTensorValue> & _chemical_diffusivity;
+  std::vector<MaterialProperty<RealTensorValue> *> _dL_dmu;
+  std::vector<MaterialProperty<RealTensorValue> *> _dL_dphi;
+};
+
+typedef MultiPhaseDiffusivity<2> TernaryMultiPhaseDiffusivity;
+typedef MultiPhaseDiffusivity<3> QuaternaryMultiPhaseDiffusivity;
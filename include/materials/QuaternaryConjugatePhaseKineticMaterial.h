@@ -0,0 +1,53 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class QuaternaryConjugatePhaseKineticMaterial;
+
+//MOOSE includes
+#include "TabulatedPhaseMaterial.h"
+#include "QuaternaryConjugatePhaseMobilityData.h"
+
+template <>
+InputParameters validParams<QuaternaryConjugatePhaseKineticMaterial>();
+
+//Material returning the properties of both QuaternaryConjugatePhaseMaterial
+//and QuaternaryConjugateKineticMaterial, with the same parameter names, from
+//a QuaternaryConjugatePhaseMobilityData: the tables are searched once per
+//quadrature point for all of them. The derivatives of the mobilities are only
+//declared when their names are given.
+
+class QuaternaryConjugatePhaseKineticMaterial : public TabulatedPhaseMaterial
+{
+public:
+  QuaternaryConjugatePhaseKineticMaterial(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+private:
+  //Diffusion potentials of components B, C and D
+  const VariableValue & _B_diff_pot;
+  const VariableValue & _C_diff_pot;
+  const VariableValue & _D_diff_pot;
+
+  //Phase properties and mobilities of the phase
+  const QuaternaryConjugatePhaseMobilityData & _table_object;
+
+  //Declared properties and their position in the values of the table object
+  std::vector<MaterialProperty<Real> *> _properties;
+  std::vector<unsigned int> _property_index;
+
+  //Values of the table at the quadrature points of the element
+  std::vector<Real> _values;
+};
@@ -31,8 +31,9 @@ public:
 
 protected:
 
-  //Member function that returns the property value at each quadrature point
-  virtual void computeQpProperties() override;
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
   
 private:
     
@@ -85,6 +86,9 @@ private:
     //tables for ternary alloys with the properties of the phase
     //and linearly interpolates the value .
     const QuaternaryConjugatePhaseData & _table_object;
+
+    //Values of the table at the quadrature points of the element
+    std::vector<Real> _values;
  
 };
 //#endif // QUATERNARYCONJUGATEPHASEMATERIAL_H
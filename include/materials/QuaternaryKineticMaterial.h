@@ -26,8 +26,9 @@ public:
 
 protected:
 
-  //Member function that returns the property value at each quadrature point
-  virtual void computeQpProperties() override;
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
   
 private:
     
@@ -92,5 +93,8 @@ private:
    //tables for quaternary alloys with the properties of the phase
    //and trilinearly interpolates the value .
    const QuaternaryMobilityData & _table_object;
+
+   //Values of the table at the quadrature points of the element
+   std::vector<Real> _values;
  
 };
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class RedlichKisterPhaseMaterial;
+
+//MOOSE includes
+#include "Material.h"
+#include "RedlichKisterFreeEnergy.h"
+
+template <>
+InputParameters validParams<RedlichKisterPhaseMaterial>();
+
+//Material that evaluates the free energy, the diffusion potentials and the
+//thermodynamic factors of a substitutional solution phase analytically from
+//its Redlich-Kister parameters (see RedlichKisterFreeEnergy), in the
+//non-dimensional form of the Tabulated*Material classes. It replaces the
+//tables of a phase with binary and ternary interaction parameters at a fixed
+//temperature, with any number of components up to
+//RedlichKisterFreeEnergy::max_components.
+
+class RedlichKisterPhaseMaterial : public Material
+{
+public:
+  RedlichKisterPhaseMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+private:
+  //Index of a component in the components parameter
+  unsigned int componentIndex(const std::string & name) const;
+
+  //Read one of the interaction_terms into the energy
+  void addInteraction(const std::string & term, Real value);
+
+  const std::vector<std::string> _components;
+
+  //Molar volume and characteristic energy of the non-dimensional form
+  const Real _Vm;
+  const Real _Ec;
+
+  //Free energy of the phase in J/mol
+  RedlichKisterFreeEnergy _energy;
+
+  //Mole fractions of the independent components (all but the first)
+  std::vector<const VariableValue *> _mole_fractions;
+
+  MaterialProperty<Real> & _free_energy;
+  std::vector<MaterialProperty<Real> *> _diff_pot;
+
+  //Upper triangle of the thermodynamic factors, row by row
+  std::vector<MaterialProperty<Real> *> _therm_factor;
+};
@@ -13,7 +13,7 @@
 #pragma once
 
 #include "Material.h"
-#include "cmath"
+#include "RedlichKisterFreeEnergy.h"
 
 //Forward declaration
 class SubstitutionalFreeEnergyMaterial;
@@ -55,6 +55,9 @@ class SubstitutionalFreeEnergyMaterial : public Material
     const std::vector<Real> _RK_val;
     //Redlich-Kister expansion terms
 
+    RedlichKisterFreeEnergy _energy;
+    //Free energy of the A-B solution, evaluated with its derivatives
+
    private:
       //component B is assumed to be independent
      const VariableValue & _xB;
@@ -70,9 +73,5 @@ class SubstitutionalFreeEnergyMaterial : public Material
      MaterialProperty<Real> & _chi;
     //Returns the second derivative with resoect to B
     //In the literature, this term is called the thermodynamic factor
- 
-     Real _G_ref, _G_conf,_G_ex; //computing the free energy
-     Real _dG_ref, _dG_conf, _dG_ex1, _dG_ex2;
-     Real _d2G_ref, _d2G_conf, _d2G_ex1, _d2G_ex2, _d2G_ex3;
 };
 //#endif //SUBSTITUTIONALFREEENERGYMATERIAL_H
@@ -0,0 +1,71 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+// Forward Declarations
+template <unsigned int N>
+class TabulatedPhaseMaterialND;
+
+//MOOSE includes
+#include "TabulatedPhaseMaterial.h"
+#include "ThermoChemicalProperties.h"
+
+//Material that declares a property for each of the chosen columns of a
+//TabulatedPhaseDataND table, found by the name of the column, and fills all
+//of them at the quadrature points of an element with one call to the table.
+//Any object providing its properties by name works in place of the table,
+//e.g. TDBPhaseData with the mole fractions as variables.
+//Registered as TabulatedPhaseMaterial1D ... TabulatedPhaseMaterial4D.
+
+template <unsigned int N>
+class TabulatedPhaseMaterialND : public TabulatedPhaseMaterial
+{
+public:
+  TabulatedPhaseMaterialND(const InputParameters & parameters);
+
+protected:
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
+
+private:
+  //The N independent variables of the table
+  std::vector<const VariableValue *> _variables;
+
+  //Table (or other source) of the phase properties
+  const ThermoChemicalProperties & _table_object;
+
+  //Position of each property among the outputs of the table
+  std::vector<unsigned int> _output_index;
+
+  //Properties returned by this material
+  std::vector<MaterialProperty<Real> *> _properties;
+
+  //Factor applied to the tabulated values
+  const Real _scale;
+
+  //Values of the table at the quadrature points of the element
+  std::vector<Real> _values;
+};
+
+typedef TabulatedPhaseMaterialND<1> TabulatedPhaseMaterial1D;
+typedef TabulatedPhaseMaterialND<2> TabulatedPhaseMaterial2D;
+typedef TabulatedPhaseMaterialND<3> TabulatedPhaseMaterial3D;
+typedef TabulatedPhaseMaterialND<4> TabulatedPhaseMaterial4D;
+
+template <>
+InputParameters validParams<TabulatedPhaseMaterial1D>();
+template <>
+InputParameters validParams<TabulatedPhaseMaterial2D>();
+template <>
+InputParameters validParams<TabulatedPhaseMaterial3D>();
+template <>
+InputParameters validParams<TabulatedPhaseMaterial4D>();
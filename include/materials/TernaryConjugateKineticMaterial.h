@@ -32,8 +32,9 @@ public:
 
 protected:
 
-  //Member function that returns the property value at each quadrature point
-  virtual void computeQpProperties() override;
+  //Member function that returns the property values at all the quadrature
+  //points of the element with a single call to the table object
+  virtual void computeProperties() override;
   
 private:
     
@@ -74,4 +75,7 @@ private:
     //tables for ternary alloys with the properties of the phase
     //and linearly interpolates the value .
    const TernaryConjugateMobilityData & _table_object;
+
+   //Values of the table at the quadrature points of the element
+   std::vector<Real> _values;
 };
@@ -0,0 +1,34 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//Included dependencies
+#include "Material.h"
+
+/**
+ * AD version of InterpolationFunction: the interpolation function
+ * h(eta) = eta^(3)(6 * eta^(2) - 15*eta + 10.0) as an AD property "h",
+ * whose derivatives w.r.t. eta come with it
+ */
+class ADInterpolationFunction : public Material
+{
+public:
+  static InputParameters validParams();
+
+  ADInterpolationFunction(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+private:
+  ADMaterialProperty<Real> & _h;
+
+  const ADVariableValue & _eta;
+};
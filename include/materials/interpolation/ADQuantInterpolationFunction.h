@@ -0,0 +1,35 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//Included dependencies
+#include "Material.h"
+
+/**
+ * AD version of QuantInterpolationFunction: the interpolation functions
+ * h_p = phi_p^2 / sum(phi^2) of the coupled phases (h_alpha, h_beta, ...)
+ * as AD properties, whose derivatives w.r.t. the phase fields come with
+ * them. Only the properties of the coupled phases are declared.
+ */
+class ADQuantInterpolationFunction : public Material
+{
+public:
+  static InputParameters validParams();
+
+  ADQuantInterpolationFunction(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+private:
+  //Phase fields of the coupled phases and their interpolation functions
+  std::vector<const ADVariableValue *> _phase;
+  std::vector<ADMaterialProperty<Real> *> _h;
+};
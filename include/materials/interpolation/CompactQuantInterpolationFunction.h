@@ -0,0 +1,75 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//Forward declaration
+class CompactQuantInterpolationFunction;
+class FEProblemBase;
+
+//Included dependencies
+#include "Material.h"
+
+#include <utility>
+
+template <>
+InputParameters validParams<CompactQuantInterpolationFunction>();
+
+//CompactQuantInterpolationFunction computes the interpolation functions of
+//QuantInterpolationFunction, h_q = phi_q^2 / sum(phi^2), for any number N of
+//phase fields, and holds them in three properties per quadrature point in
+//place of about 130 scalar properties:
+//  h    h_q                                   N values
+//  dh   dh_q/dphi_p at q*N + p                N*N values
+//  d2h  d2h_q/dphi_p dphi_r at q*M + hessianIndex(p, r), with p <= r and
+//       M = N*(N+1)/2, since the Hessian of each h_q is symmetric
+//Phases are numbered in the order of phase_fields. The derivatives are only
+//computed when an object requests them (d2h needs dh).
+
+class CompactQuantInterpolationFunction : public Material
+{
+public:
+  CompactQuantInterpolationFunction(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  //Position of d2h/dphi_p dphi_r in the symmetric storage of a Hessian
+  static unsigned int hessianIndex(unsigned int p, unsigned int r, unsigned int num_phases)
+  {
+    if (p > r)
+      std::swap(p, r);
+    return p * num_phases - p * (p - 1) / 2 + r - p;
+  }
+
+  //Number of phases of the material declaring the properties prefixed with
+  //base_name ("" or "<base_name>_"), or 0 if there is none
+  static unsigned int
+  numPhases(FEProblemBase & problem, const std::string & base_name, THREAD_ID tid);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  //Name of a property declared by this material
+  std::string propertyName(const std::string & name) const;
+
+  const std::string _base_name;
+
+  //Phase fields, their number and the size of a packed Hessian
+  std::vector<const VariableValue *> _phase_fields;
+  const unsigned int _num_phases;
+  const unsigned int _hessian_size;
+
+  MaterialProperty<std::vector<Real>> & _h;
+  MaterialProperty<std::vector<Real>> & _dh;
+  MaterialProperty<std::vector<Real>> & _d2h;
+
+  //Whether the derivatives are requested (see initialSetup())
+  bool _compute_dh;
+  bool _compute_d2h;
+};
@@ -16,6 +16,8 @@ class ComputeOverallStress;
 #include "RankTwoTensor.h"
 #include "RankFourTensor.h"
 
+#include <array>
+
 template <>
 InputParameters validParams<ComputeOverallStress>();
 
@@ -31,7 +33,19 @@ protected:
 
   //Member function that returns the property value at each quadrature point
   virtual void computeQpProperties() override;
-  
+
+  //The tensors are handled in Mandel notation (Voigt order 11, 22, 33, 23,
+  //13, 12 with the shear terms scaled by sqrt(2)): the double contractions
+  //of tensors with minor symmetries are then 6x6 matrix products and
+  //transposeMajor() is the matrix transpose
+  typedef std::array<Real, 6> MandelVector;
+  typedef std::array<MandelVector, 6> MandelMatrix;
+
+  static MandelVector toMandel(const RankTwoTensor & t);
+  static MandelMatrix toMandel(const RankFourTensor & t);
+  static void fromMandel(const MandelVector & v, RankTwoTensor & t);
+  static void fromMandel(const MandelMatrix & m, RankFourTensor & t);
+
 private:
     
     const MaterialProperty<RankTwoTensor> & _alpha_stress;
@@ -16,7 +16,7 @@ class BinaryConjugateMobilityData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "LinearInterpolation.h"
+#include "MultiFieldLinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 
@@ -59,11 +59,11 @@ private:
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
-    //variable to hold interpolated mobility L_BB
-    std::unique_ptr<LinearInterpolation> _interpolate_L_BB;
-    
-    //variable to hold interpolated derivative
-    std::unique_ptr<LinearInterpolation> _interpolate_dL_BB_muB;
+    //Columns of the table after the B_diff_pot
+    enum Property { LBB, DL_BB_MUB, NUM_PROPERTIES };
+
+    //The mobility and its derivative are interpolated together on the B_diff_pot grid
+    std::unique_ptr<MultiFieldLinearInterpolation> _interpolate_properties;
        
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
@@ -16,7 +16,7 @@ class BinaryConjugatePhaseData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "LinearInterpolation.h"
+#include "MultiFieldLinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 template <>
@@ -62,14 +62,11 @@ private:
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
-    //variable to hold interpolated chemical potential of A
-    std::unique_ptr<LinearInterpolation> _interpolate_chem_pot_A;
-    
-    //variable to hold interpolated chem_pot of comp A And B
-    std::unique_ptr<LinearInterpolation> _interpolate_xB;
-    
-    //variable to hold interpolated inv  of thermodynamic factor;
-    std::unique_ptr<LinearInterpolation> _interpolate_inv_tf_B;
+    //Columns of the table after the diffusion potential
+    enum Property { CHEM_POT_A, XB, INV_TF_B, NUM_PROPERTIES };
+
+    //All the properties are interpolated together on the B_diff_pot grid
+    std::unique_ptr<MultiFieldLinearInterpolation> _interpolate_properties;
     
     //variable to hold interpolated inv of the third derivative
     //std::unique_ptr<LinearInterpolation> _interpolate_inv_td_B;
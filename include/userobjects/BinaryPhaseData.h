@@ -16,7 +16,7 @@ class BinaryPhaseData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "LinearInterpolation.h"
+#include "MultiFieldLinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 
@@ -62,14 +62,11 @@ private:
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
-    //variable to hold interpolated free energy
-    std::unique_ptr<LinearInterpolation> _interpolate_free_energy;
-    
-    //variable to hold interpolated chem_pot of comp A And B
-    std::unique_ptr<LinearInterpolation> _interpolate_B_diff_pot;
-    
-    //variable to hold interpolated thermodynamic factor;
-    std::unique_ptr<LinearInterpolation> _interpolate_B_therm_factor;
+    //Columns of the table after the mole fraction
+    enum Property { GM, B_DIFF_POT, TF_B, NUM_PROPERTIES };
+
+    //All the properties are interpolated together on the xB grid
+    std::unique_ptr<MultiFieldLinearInterpolation> _interpolate_properties;
        
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
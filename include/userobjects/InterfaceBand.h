@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//Forward declaration
+class InterfaceBand;
+
+//MOOSE includes
+#include "ElementUserObject.h"
+
+#include <unordered_set>
+
+template <>
+InputParameters validParams<InterfaceBand>();
+
+//InterfaceBand sorts the elements into bulk elements, where at every
+//quadrature point each phase field is within bulk_tolerance of 0 or 1 (and
+//at most one of them is at 1), and the band of the other elements around
+//the interfaces. The band is widened by one layer of face neighbours so that
+//an interface moving during the time step stays inside it.
+//In bulk elements the interpolation functions are flat, so the off-diagonal
+//Jacobian terms proportional to their first derivatives are negligible and
+//the kernels may skip them (see the interface_band parameter of
+//MultiPhaseBase, BinaryMultiPhaseDrivingForce and GBinaryMultiPhaseDrivingForce).
+//The residuals and the interpolation functions themselves are always exact.
+//Each rank only classifies its own elements.
+
+class InterfaceBand : public ElementUserObject
+{
+public:
+  InterfaceBand(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  //Whether the local element lies away from every interface. The elements
+  //not classified yet (created since the last execution) are in the band.
+  bool isBulk(const Elem * elem) const { return _bulk_elems.count(elem->id()); }
+
+protected:
+  //Phase fields of all the phases
+  std::vector<const VariableValue *> _phase_fields;
+
+  //Largest distance of a phase field from 0 or 1 in the bulk
+  const Real _tolerance;
+
+  //Elements visited by this thread
+  std::vector<dof_id_type> _elems;
+
+  //Elements containing an interface, found by this thread
+  std::vector<dof_id_type> _interface_elems;
+
+  //Local elements away from every interface
+  std::unordered_set<dof_id_type> _bulk_elems;
+};
@@ -16,7 +16,7 @@ class QuaternaryChemPotentialData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "TrilinearInterpolation.h"
+#include "MultiFieldTrilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 
@@ -60,14 +60,20 @@ public:
   //Return interpolated second derivative mu(A).x(D)
   virtual Real thermodynamic_factor_AD(const Real& _xB, const Real& _xC, const Real& _xD) const;
 
+  //Return all the above properties with a single search of the table
+  virtual void all_properties(const Real & _xB, const Real & _xC, const Real & _xD,
+                              Real & A_chem_pot,
+                              Real & therm_factor_AB, Real & therm_factor_AC,
+                              Real & therm_factor_AD) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<TrilinearInterpolation>_interpolate_chem_pot_A,
-                                           _interpolate_therm_factor_AB,
-                                           _interpolate_therm_factor_AC,
-                                           _interpolate_therm_factor_AD;
+    //Position of each property in the interpolation table
+    enum Property { CHEM_POT_A, TF_AB, TF_AC, TF_AD, NUM_PROPERTIES };
 
+    //All the properties are interpolated together on the grid of the
+    //three independent variables
+    std::unique_ptr<MultiFieldTrilinearInterpolation> _interpolate_properties;
 
     //variable to hold the string type table name from input file
     FileName _table_name;
@@ -13,7 +13,7 @@ class QuaternaryConjugateMobilityData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "TrilinearInterpolation.h"
+#include "MultiFieldTrilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 template <>
@@ -30,6 +30,14 @@ InputParameters validParams<QuaternaryConjugateMobilityData>();
 class QuaternaryConjugateMobilityData : public ThermoChemicalProperties
 {
 public:
+  //Position of each mobility and derivative in the table, which is also
+  //the order of the values returned by all_properties() and evaluate()
+  enum Property { LBB, LCC, LDD, LBC, LBD, LCD,
+                  DLBB_MUB, DLCC_MUB, DLDD_MUB, DLBC_MUB, DLBD_MUB, DLCD_MUB,
+                  DLBB_MUC, DLCC_MUC, DLDD_MUC, DLBC_MUC, DLBD_MUC, DLCD_MUC,
+                  DLBB_MUD, DLCC_MUD, DLDD_MUD, DLBC_MUD, DLBD_MUD, DLCD_MUD,
+                  NUM_PROPERTIES };
+
   QuaternaryConjugateMobilityData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -81,20 +89,26 @@ public:
   virtual Real dL_BD_muD(const Real& _B_diff_pot, const Real& _C_diff_pot, const Real& _D_diff_pot) const;
   virtual Real dL_CD_muD(const Real& _B_diff_pot, const Real& _C_diff_pot, const Real& _D_diff_pot) const;
   
+  //Return all the mobilities and their derivatives with a single search of the table;
+  //values must hold NUM_PROPERTIES entries
+  virtual void all_properties(const Real & _B_diff_pot, const Real & _C_diff_pot,
+                              const Real & _D_diff_pot,
+                              Real * values) const;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n,
+                const Real * B_diff_pot,
+                const Real * C_diff_pot,
+                const Real * D_diff_pot,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<TrilinearInterpolation>_interpolate_LBB, _interpolate_LCC, _interpolate_LDD,
-                                           _interpolate_LBC, _interpolate_LBD, _interpolate_LCD,
-                                           _interpolate_dLBB_muB, _interpolate_dLCC_muB, _interpolate_dLDD_muB,
-                                           _interpolate_dLBC_muB, _interpolate_dLBD_muB, _interpolate_dLCD_muB,
-                                           _interpolate_dLBB_muC, _interpolate_dLCC_muC, _interpolate_dLDD_muC,
-                                           _interpolate_dLBC_muC, _interpolate_dLBD_muC, _interpolate_dLCD_muC,
-                                           _interpolate_dLBB_muD, _interpolate_dLCC_muD, _interpolate_dLDD_muD,
-                                           _interpolate_dLBC_muD, _interpolate_dLBD_muD, _interpolate_dLCD_muD;
+    //All the properties are interpolated together on the grid of the
+    //three independent variables
+    std::unique_ptr<MultiFieldTrilinearInterpolation> _interpolate_properties;
 
-                                           
-   
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
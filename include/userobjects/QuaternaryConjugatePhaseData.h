@@ -16,7 +16,7 @@ class QuaternaryConjugatePhaseData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "TrilinearInterpolation.h"
+#include "MultiFieldTricubicInterpolation.h"
 #include "DelimitedFileReader.h"
 
 template <>
@@ -33,6 +33,11 @@ InputParameters validParams<QuaternaryConjugatePhaseData>();
 class QuaternaryConjugatePhaseData : public ThermoChemicalProperties
 {
 public:
+  //Position of each property in the table, which is also the order of
+  //the values returned by evaluate()
+  enum Property { CHEM_POT_A, XB, XC, XD, INV_TF_B, INV_TF_C, INV_TF_D, INV_TF_BC, INV_TF_BD,
+                  INV_TF_CD, NUM_PROPERTIES };
+
   QuaternaryConjugatePhaseData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -76,23 +81,36 @@ public:
   
   //Return interpolated inv second derivative w.r.t C,D
   virtual Real inv_therm_factor_CD(const Real& _B_diff_pot, const Real& _C_diff_pot, const Real& _D_diff_pot) const;
+
+  //Return all the above properties with a single search of the table
+  virtual void all_properties(const Real & _B_diff_pot, const Real & _C_diff_pot,
+                              const Real & _D_diff_pot,
+                              Real & A_chem_pot,
+                              Real & xB, Real & xC, Real & xD,
+                              Real & inv_therm_factor_B, Real & inv_therm_factor_C,
+                              Real & inv_therm_factor_D, Real & inv_therm_factor_BC,
+                              Real & inv_therm_factor_BD, Real & inv_therm_factor_CD) const;
   
 
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n,
+                const Real * B_diff_pot,
+                const Real * C_diff_pot,
+                const Real * D_diff_pot,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<TrilinearInterpolation>_interpolate_chem_pot_A, 
-                                           _interpolate_xB,
-                                           _interpolate_xC,
-                                           _interpolate_xD,
-                                           _interpolate_inv_tf_B,
-                                           _interpolate_inv_tf_C,
-                                           _interpolate_inv_tf_D,
-                                           _interpolate_inv_tf_BC,
-                                           _interpolate_inv_tf_BD,
-                                           _interpolate_inv_tf_CD;
+    //All the properties are interpolated together on the grid of the
+    //three independent variables
+    std::unique_ptr<MultiFieldTrilinearInterpolation> _interpolate_properties;
+
+    //Tricubic interpolation of the same table, if it was requested: the
+    //inverse thermodynamic factors are then the derivatives of the mole fractions
+    std::unique_ptr<MultiFieldTricubicInterpolation> _cubic_properties;
+    const bool _cubic;
 
-   
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
@@ -112,5 +130,12 @@ private:
     
     //Declare variables to store the number of data points
     unsigned int _num_xB, _num_xC, _num_xD;    
+
+    //Every property at a point from the tricubic interpolation, in the
+    //order of the enum Property
+    void cubicProperties(const Real & B_diff_pot, const Real & C_diff_pot,
+                         const Real & D_diff_pot, Real * values) const;
+    Real cubicProperty(const Real & B_diff_pot, const Real & C_diff_pot,
+                       const Real & D_diff_pot, Property property) const;
 };
 //#endif // QUATERNARYCONJUGATEPHASEDATA_H
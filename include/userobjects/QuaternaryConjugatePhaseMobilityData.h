@@ -0,0 +1,70 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class QuaternaryConjugatePhaseMobilityData;
+
+//MOOSE includes
+#include "ThermoChemicalProperties.h"
+#include "QuaternaryConjugatePhaseData.h"
+#include "QuaternaryConjugateMobilityData.h"
+#include "MultiFieldTrilinearInterpolation.h"
+
+template <>
+InputParameters validParams<QuaternaryConjugatePhaseMobilityData>();
+
+//QuaternaryConjugatePhaseMobilityData holds the phase table of
+//QuaternaryConjugatePhaseData and the mobility table of
+//QuaternaryConjugateMobilityData of the same phase, tabulated on the same
+//grid of diffusion potentials, in a single interpolation. The cell of a point
+//is then located once for the compositions, the inverse thermodynamic factors,
+//the Onsager mobilities and their derivatives (see
+//QuaternaryConjugatePhaseKineticMaterial).
+
+class QuaternaryConjugatePhaseMobilityData : public ThermoChemicalProperties
+{
+public:
+  //Position of the first phase property and of the first mobility among the
+  //values returned by evaluate(); the properties of each table keep the
+  //order of its enum Property
+  enum Offset
+  {
+    PHASE = 0,
+    MOBILITY = QuaternaryConjugatePhaseData::NUM_PROPERTIES,
+    NUM_PROPERTIES = MOBILITY + QuaternaryConjugateMobilityData::NUM_PROPERTIES
+  };
+
+  QuaternaryConjugatePhaseMobilityData(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n,
+                const Real * B_diff_pot,
+                const Real * C_diff_pot,
+                const Real * D_diff_pot,
+                std::vector<Real> & values) const;
+
+private:
+  //Append the grid and the property columns of a table to axes and properties
+  void readTable(const FileName & table_name,
+                 unsigned int num_properties,
+                 std::vector<Real> * axes,
+                 std::vector<std::vector<Real>> & properties) const;
+
+  //All the properties of both tables are interpolated together
+  std::unique_ptr<MultiFieldTrilinearInterpolation> _interpolate_properties;
+
+  //Tables of the phase and of the mobilities
+  const FileName _phase_table_name;
+  const FileName _mobility_table_name;
+};
@@ -0,0 +1,85 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class QuaternaryConjugateTableGenerator;
+
+//MOOSE includes
+#include "GeneralUserObject.h"
+#include "MultiFieldTrilinearInterpolation.h"
+
+template <>
+InputParameters validParams<QuaternaryConjugateTableGenerator>();
+
+//QuaternaryConjugateTableGenerator writes the table read by
+//QuaternaryConjugatePhaseData from a table in the format of
+//QuaternaryPhaseData. The forward table gives the chemical potentials and the
+//thermodynamic factors as functions of the mole fractions; the diffusion
+//potentials mu_X - mu_A are inverted on a regular grid of diffusion
+//potentials by a Newton solve, with the thermodynamic factors as Jacobian.
+//The points of the grid are divided between the MPI ranks, which send their
+//rows in turn to the first rank to be written. The values are
+//written in non-dimensional form, as expected by the conjugate materials.
+//The generated table starts with a hash of the forward table and of the
+//parameters of the inversion, and is only generated again when they change.
+//The table is generated when this object is constructed, so that it exists
+//when the *Data objects read their tables in initialSetup().
+
+class QuaternaryConjugateTableGenerator : public GeneralUserObject
+{
+public:
+  QuaternaryConjugateTableGenerator(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+private:
+  //Hash of the forward table and of the parameters of the inversion
+  std::string sourceHash() const;
+
+  //Whether the conjugate table exists and was generated from the same source
+  bool upToDate(const std::string & hash) const;
+
+  //Invert the forward table and write the conjugate table
+  void generate(const std::string & hash);
+
+  //Newton solve for the mole fractions x at which the non-dimensional
+  //diffusion potentials equal target; x holds the initial guess and the
+  //solution. Returns the norm of the residual.
+  Real invert(const Real * target, Real * x) const;
+
+  //Non-dimensional diffusion potentials and thermodynamic factors at x
+  void forwardProperties(const Real * x, Real * diff_pot, Real tf[3][3]) const;
+
+  //Node of a coarse subset of the forward grid with the closest diffusion
+  //potentials to target, used as initial guess when the previous point fails
+  void closestNode(const Real * target, Real * x) const;
+
+  const FileName _forward_table_name;
+  const FileName _conjugate_table_name;
+
+  //Grid of diffusion potentials of B, C and D of the conjugate table
+  const std::vector<Real> _diff_pot_min;
+  const std::vector<Real> _diff_pot_max;
+  const std::vector<unsigned int> _num_points;
+
+  //Scaling of the forward table into non-dimensional form (see TabulatedPhaseMaterial)
+  const Real _Vm;
+  const Real _Ec;
+
+  //Newton parameters
+  const Real _tolerance;
+  const unsigned int _max_iterations;
+
+  //Interpolation of the forward table
+  std::unique_ptr<MultiFieldTrilinearInterpolation> _forward;
+};
@@ -13,7 +13,7 @@ class QuaternaryMobilityData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "TrilinearInterpolation.h"
+#include "MultiFieldTrilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 
@@ -29,6 +29,14 @@ InputParameters validParams<QuaternaryMobilityData>();
 class QuaternaryMobilityData : public ThermoChemicalProperties
 {
 public:
+  //Position of each mobility and derivative in the table, which is also
+  //the order of the values returned by all_properties() and evaluate()
+  enum Property { LBB, LCC, LDD, LBC, LBD, LCD,
+                  DLBB_XB, DLCC_XB, DLDD_XB, DLBC_XB, DLBD_XB, DLCD_XB,
+                  DLBB_XC, DLCC_XC, DLDD_XC, DLBC_XC, DLBD_XC, DLCD_XC,
+                  DLBB_XD, DLCC_XD, DLDD_XD, DLBC_XD, DLBD_XD, DLCD_XD,
+                  NUM_PROPERTIES };
+
   QuaternaryMobilityData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -80,18 +88,22 @@ public:
   virtual Real dL_BD_xD(const Real& _xB, const Real& _xC, const Real& _xD) const;
   virtual Real dL_CD_xD(const Real& _xB, const Real& _xC, const Real& _xD) const;
 
+  //Return all the mobilities and their derivatives with a single search of the table;
+  //values must hold NUM_PROPERTIES entries
+  virtual void all_properties(const Real & _xB, const Real & _xC, const Real & _xD,
+                              Real * values) const;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n, const Real * xB, const Real * xC, const Real * xD,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<TrilinearInterpolation>_interpolate_LBB, _interpolate_LCC, _interpolate_LDD,
-                                           _interpolate_LBC, _interpolate_LBD, _interpolate_LCD,
-                                           _interpolate_dLBB_xB, _interpolate_dLCC_xB, _interpolate_dLDD_xB,
-                                           _interpolate_dLBC_xB, _interpolate_dLBD_xB, _interpolate_dLCD_xB,
-                                           _interpolate_dLBB_xC, _interpolate_dLCC_xC, _interpolate_dLDD_xC,
-                                           _interpolate_dLBC_xC, _interpolate_dLBD_xC, _interpolate_dLCD_xC,
-                                           _interpolate_dLBB_xD, _interpolate_dLCC_xD, _interpolate_dLDD_xD,
-                                           _interpolate_dLBC_xD, _interpolate_dLBD_xD, _interpolate_dLCD_xD;
-                                           
+    //All the properties are interpolated together on the grid of the
+    //three independent variables
+    std::unique_ptr<MultiFieldTrilinearInterpolation> _interpolate_properties;
+
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
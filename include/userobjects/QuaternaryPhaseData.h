@@ -15,7 +15,7 @@ class QuaternaryPhaseData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "TrilinearInterpolation.h"
+#include "MultiFieldTrilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
 
@@ -33,6 +33,11 @@ InputParameters validParams<QuaternaryPhaseData>();
 class QuaternaryPhaseData : public ThermoChemicalProperties
 {
 public:
+  //Position of each property in the table, which is also the order of
+  //the values returned by evaluate()
+  enum Property { CHEM_POT_A, CHEM_POT_B, CHEM_POT_C, CHEM_POT_D, TF_B, TF_C, TF_D, TF_BC,
+                  TF_BD, TF_CD, NUM_PROPERTIES };
+
   QuaternaryPhaseData(const InputParameters & parameters);
 
   //Destructor is a member function which has the
@@ -74,20 +79,23 @@ public:
   //Return interpolated second derivative mu(C).x(D)
   virtual Real thermodynamic_factor_CD(const Real& _xB, const Real& _xC, const Real& _xD) const;
 
-private:
+  //Return all the above properties with a single search of the table
+  virtual void all_properties(const Real & _xB, const Real & _xC, const Real & _xD,
+                              Real & B_diff_pot, Real & C_diff_pot, Real & D_diff_pot,
+                              Real & therm_factor_B, Real & therm_factor_C,
+                              Real & therm_factor_D, Real & therm_factor_BC,
+                              Real & therm_factor_BD, Real & therm_factor_CD) const;
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<TrilinearInterpolation>_interpolate_chem_pot_A,
-                                           _interpolate_chem_pot_B,
-                                           _interpolate_chem_pot_C,
-                                           _interpolate_chem_pot_D,
-                                           _interpolate_therm_factor_B,
-                                           _interpolate_therm_factor_C,
-                                           _interpolate_therm_factor_D,
-                                           _interpolate_therm_factor_BC,
-                                           _interpolate_therm_factor_BD,
-                                           _interpolate_therm_factor_CD;
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n, const Real * xB, const Real * xC, const Real * xD,
+                std::vector<Real> & values) const;
+
+private:
 
+    //All the properties are interpolated together on the grid of the
+    //three independent variables
+    std::unique_ptr<MultiFieldTrilinearInterpolation> _interpolate_properties;
 
     //variable to hold the string type table name from input file
     FileName _table_name;
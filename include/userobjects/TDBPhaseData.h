@@ -0,0 +1,63 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+// Forward Declarations
+class TDBPhaseData;
+
+//MOOSE includes
+#include "ThermoChemicalProperties.h"
+#include "RedlichKisterFreeEnergy.h"
+
+template <>
+InputParameters validParams<TDBPhaseData>();
+
+//TDBPhaseData provides the properties of a substitutional solution phase
+//from its parameters in a CALPHAD database (see TDBDatabase) instead of a
+//table. The temperature expressions of the database are evaluated once, and
+//the free energy and its derivatives are then computed analytically at each
+//point by RedlichKisterFreeEnergy, in J/mol as in the tables. The outputs are
+//looked up by name like the columns of TabulatedPhaseDataND, with the
+//independent mole fractions (all the components but the first) as variables:
+//  GM                  molar Gibbs energy
+//  CHEM_POT_X          chemical potential of every component X
+//  DIFF_POT_X          diffusion potential mu_X - mu_A of the independent ones
+//  TF_X, TF_X_Y        thermodynamic factors (second derivatives), X before Y
+
+class TDBPhaseData : public ThermoChemicalProperties
+{
+public:
+  TDBPhaseData(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  virtual unsigned int numVariables() const override { return _components.size() - 1; }
+  virtual unsigned int numOutputs() const override { return _output_names.size(); }
+  virtual unsigned int outputIndex(const std::string & output) const override;
+
+  //Every output at the independent mole fractions x[0 .. numVariables()-1];
+  //values must hold numOutputs() entries
+  void evaluate(const Real * x, Real * values) const;
+
+  virtual void evaluateOutputs(unsigned int n,
+                               const Real * const * x,
+                               std::vector<Real> & values) const override;
+
+private:
+  const FileName _tdb_file;
+  const std::string _phase_name;
+  const std::vector<std::string> _components;
+  const Real _T;
+
+  //Names of the outputs in the order of the values of evaluate()
+  std::vector<std::string> _output_names;
+
+  std::unique_ptr<RedlichKisterFreeEnergy> _energy;
+};
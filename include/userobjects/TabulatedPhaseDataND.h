@@ -0,0 +1,83 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+// Forward Declarations
+template <unsigned int N>
+class TabulatedPhaseDataND;
+
+//MOOSE includes
+#include "ThermoChemicalProperties.h"
+#include "MultiFieldMultilinearInterpolation.h"
+#include "DelimitedFileReader.h"
+
+//One object for tables of any number N of independent variables (mole
+//fractions or diffusion potentials). The independent and the interpolated
+//columns are chosen by their names in the header of the table, and the
+//materials refer to the interpolated columns by name through outputIndex(),
+//so a new kind of table needs neither a new userobject nor a new enum.
+//The tables are interpolated with MultiFieldMultilinearInterpolation<N>,
+//which also reads and writes their binary copies.
+//Registered as TabulatedPhaseData1D ... TabulatedPhaseData4D.
+
+template <unsigned int N>
+class TabulatedPhaseDataND : public ThermoChemicalProperties
+{
+public:
+  TabulatedPhaseDataND(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+  //Number of independent variables and of interpolated columns
+  virtual unsigned int numVariables() const override { return N; }
+  virtual unsigned int numOutputs() const override { return _output_names.size(); }
+
+  //Position of the column named column among the interpolated columns,
+  //which is also its position in the values returned by evaluate()
+  virtual unsigned int outputIndex(const std::string & column) const override;
+
+  //Interpolate every output at the point x[0..N-1]; values must hold numOutputs() entries
+  void evaluate(const Real * x, Real * values) const;
+
+  //Interpolate every output at n points, e.g. the quadrature points of an
+  //element: x[d][q] is variable d of point q and values[o*n + q] holds output o
+  virtual void evaluateOutputs(unsigned int n,
+                               const Real * const * x,
+                               std::vector<Real> & values) const override;
+
+private:
+  //All the outputs are interpolated together on the grid of the N variables
+  std::unique_ptr<MultiFieldMultilinearInterpolation<N>> _interpolate_properties;
+
+  //variable to hold the string type table name from input file
+  FileName _table_name;
+
+  //Names of the independent and of the interpolated columns
+  std::vector<std::string> _variable_names;
+  const std::vector<std::string> _output_names;
+
+  //Moose utility csv_reader defined for reading the table
+  MooseUtils::DelimitedFileReader _table_reader;
+};
+
+typedef TabulatedPhaseDataND<1> TabulatedPhaseData1D;
+typedef TabulatedPhaseDataND<2> TabulatedPhaseData2D;
+typedef TabulatedPhaseDataND<3> TabulatedPhaseData3D;
+typedef TabulatedPhaseDataND<4> TabulatedPhaseData4D;
+
+template <>
+InputParameters validParams<TabulatedPhaseData1D>();
+template <>
+InputParameters validParams<TabulatedPhaseData2D>();
+template <>
+InputParameters validParams<TabulatedPhaseData3D>();
+template <>
+InputParameters validParams<TabulatedPhaseData4D>();
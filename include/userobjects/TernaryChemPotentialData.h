@@ -16,11 +16,8 @@ class TernaryChemPotentialData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "BilinearInterpolation.h"
+#include "MultiFieldBilinearInterpolation.h"
 #include "DelimitedFileReader.h"
-template <typename>
-class ColumnMajorMatrixTempl;
-typedef ColumnMajorMatrixTempl<Real> ColumnMajorMatrix;
 
 template <>
 InputParameters validParams<TernaryChemPotentialData>();
@@ -61,10 +58,11 @@ public:
  
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<BilinearInterpolation> _interpolate_chem_pot_A,
-                                           _interpolate_therm_factor_AB,
-                                           _interpolate_therm_factor_AC;
+    //Columns of the table after the grid points
+    enum Property { CHEM_POT_A, TF_AB, TF_AC, NUM_PROPERTIES };
+
+    //All the properties are interpolated together on the (xB, xC) grid
+    std::unique_ptr<MultiFieldBilinearInterpolation> _interpolate_properties;
 
    
     //variable to hold the string type table name from input file
@@ -72,7 +70,6 @@ private:
     
     std::vector<Real> _xB, _xC;
     
-    ColumnMajorMatrix  _chemAMatrix, _tfactorABMatrix, _tfactorACMatrix;
     
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
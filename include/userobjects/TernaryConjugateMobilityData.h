@@ -16,12 +16,9 @@ class TernaryConjugateMobilityData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "BilinearInterpolation.h"
+#include "MultiFieldBilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
-template <typename>
-class ColumnMajorMatrixTempl;
-typedef ColumnMajorMatrixTempl<Real> ColumnMajorMatrix;
 
 template <>
 InputParameters validParams<TernaryConjugateMobilityData>();
@@ -37,6 +34,11 @@ InputParameters validParams<TernaryConjugateMobilityData>();
 class TernaryConjugateMobilityData : public ThermoChemicalProperties
 {
 public:
+  //Columns of the table after the grid points, which is also the order of
+  //the values returned by evaluate()
+  enum Property { LBB, LBC, LCC, DLBB_MUB, DLBB_MUC, DLBC_MUB, DLBC_MUC, DLCC_MUB, DLCC_MUC,
+                  NUM_PROPERTIES };
+
   TernaryConjugateMobilityData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -76,18 +78,15 @@ public:
   
   virtual Real dL_CC_muC(const Real& _B_diff_pot, const Real& _C_diff_pot) const;
 
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n, const Real * B_diff_pot, const Real * C_diff_pot,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<BilinearInterpolation> _interpolate_LBB, 
-                                           _interpolate_LBC,
-                                           _interpolate_LCC,
-                                           _interpolate_dLBB_muB,
-                                           _interpolate_dLBB_muC,
-                                           _interpolate_dLBC_muB,
-                                           _interpolate_dLBC_muC,
-                                           _interpolate_dLCC_muB,
-                                           _interpolate_dLCC_muC;
+    //All the properties are interpolated together on the (B_diff_pot, C_diff_pot) grid
+    std::unique_ptr<MultiFieldBilinearInterpolation> _interpolate_properties;
                                            
    
     //variable to hold the string type table name from input file
@@ -95,9 +94,6 @@ private:
     
     std::vector<Real> _B_diff_pot, _C_diff_pot;
     
-    ColumnMajorMatrix _LBBMatrix,    _LBCMatrix,    _LCCMatrix,
-                      _dLBBmuBMatrix, _dLBBmuCMatrix, _dLBCmuBMatrix,
-                      _dLBCmuCMatrix, _dLCCmuBMatrix, _dLCCmuCMatrix;
     
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
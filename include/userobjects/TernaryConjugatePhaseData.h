@@ -16,11 +16,8 @@ class TernaryConjugatePhaseData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "BilinearInterpolation.h"
+#include "MultiFieldBilinearInterpolation.h"
 #include "DelimitedFileReader.h"
-template <typename>
-class ColumnMajorMatrixTempl;
-typedef ColumnMajorMatrixTempl<Real> ColumnMajorMatrix;
 
 template <>
 InputParameters validParams<TernaryConjugatePhaseData>();
@@ -36,6 +33,10 @@ InputParameters validParams<TernaryConjugatePhaseData>();
 class TernaryConjugatePhaseData : public ThermoChemicalProperties
 {
 public:
+  //Columns of the table after the grid points, which is also the order of
+  //the values returned by evaluate()
+  enum Property { CHEM_POT_A, XB, XC, INV_TF_B, INV_TF_BC, INV_TF_C, NUM_PROPERTIES };
+
   TernaryConjugatePhaseData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -68,15 +69,15 @@ public:
   //Return interpolated second derivative w.r.t C
   virtual Real inv_therm_factor_C(const Real& _B_diff_pot, const Real& _C_diff_pot) const;
 
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n, const Real * B_diff_pot, const Real * C_diff_pot,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<BilinearInterpolation> _interpolate_chem_pot_A, 
-                                           _interpolate_xB,
-                                           _interpolate_xC,
-                                           _interpolate_inv_tf_B,
-                                           _interpolate_inv_tf_BC,
-                                           _interpolate_inv_tf_C;
+    //All the properties are interpolated together on the (B_diff_pot, C_diff_pot) grid
+    std::unique_ptr<MultiFieldBilinearInterpolation> _interpolate_properties;
 
    
     //variable to hold the string type table name from input file
@@ -84,8 +85,6 @@ private:
     
     std::vector<Real> _B_diff_pot, _C_diff_pot;
     
-    ColumnMajorMatrix _chemAMatrix, _xBMatrix, _xCMatrix, 
-                      _inv_tfactorBMatrix, _inv_tfactorBCMatrix, _inv_tfactorCMatrix;
     
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
@@ -16,13 +16,9 @@ class TernaryMobilityData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "BilinearInterpolation.h"
+#include "MultiFieldBilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
-template <typename>
-class ColumnMajorMatrixTempl;
-typedef ColumnMajorMatrixTempl<Real> ColumnMajorMatrix;
-
 template <>
 InputParameters validParams<TernaryMobilityData>();
 
@@ -37,6 +33,11 @@ InputParameters validParams<TernaryMobilityData>();
 class TernaryMobilityData : public ThermoChemicalProperties
 {
 public:
+  //Position of each property in the table, which is also the order of
+  //the values returned by evaluate()
+  enum Property { LBB, LBC, LCC, DLBB_XB, DLBB_XC, DLBC_XB, DLBC_XC, DLCC_XB, DLCC_XC,
+                  NUM_PROPERTIES };
+
   TernaryMobilityData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -76,29 +77,28 @@ public:
   
   virtual Real dL_CC_xC(const Real & _xB, const Real & _xC) const;
 
+  //Return the mobilities and their derivatives with a single search of the table
+  virtual void all_properties(const Real & _xB, const Real & _xC,
+                              Real & L_BB, Real & L_BC, Real & L_CC,
+                              Real & dL_BB_xB, Real & dL_BB_xC,
+                              Real & dL_BC_xB, Real & dL_BC_xC,
+                              Real & dL_CC_xB, Real & dL_CC_xC) const;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n, const Real * xB, const Real * xC,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<BilinearInterpolation> _interpolate_LBB, 
-                                           _interpolate_LBC,
-                                           _interpolate_LCC,
-                                           _interpolate_dLBB_xB,
-                                           _interpolate_dLBB_xC,
-                                           _interpolate_dLBC_xB,
-                                           _interpolate_dLBC_xC,
-                                           _interpolate_dLCC_xB,
-                                           _interpolate_dLCC_xC;
-                                           
+    //All the properties are interpolated together on the (xB, xC) grid
+    std::unique_ptr<MultiFieldBilinearInterpolation> _interpolate_properties;
    
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
     std::vector<Real> _xB, _xC;
     
-    ColumnMajorMatrix _LBBMatrix,    _LBCMatrix,    _LCCMatrix,
-                      _dLBBxBMatrix, _dLBBxCMatrix, _dLBCxBMatrix,
-                      _dLBCxCMatrix, _dLCCxBMatrix, _dLCCxCMatrix;
-    
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
     // a namespace MoseUtils and hence to create object
@@ -15,13 +15,9 @@ class TernaryPhaseData;
 
 //MOOSE includes
 #include "ThermoChemicalProperties.h"
-#include "BilinearInterpolation.h"
+#include "MultiFieldBilinearInterpolation.h"
 #include "DelimitedFileReader.h"
 
-template <typename>
-class ColumnMajorMatrixTempl;
-typedef ColumnMajorMatrixTempl<Real> ColumnMajorMatrix;
-
 template <>
 InputParameters validParams<TernaryPhaseData>();
 
@@ -36,6 +32,10 @@ InputParameters validParams<TernaryPhaseData>();
 class TernaryPhaseData : public ThermoChemicalProperties
 {
 public:
+  //Position of each property in the table, which is also the order of
+  //the values returned by evaluate()
+  enum Property { GM, CHEM_POT_A, CHEM_POT_B, CHEM_POT_C, TF_B, TF_BC, TF_C, NUM_PROPERTIES };
+
   TernaryPhaseData(const InputParameters & parameters);
   
   //Destructor is a member function which has the 
@@ -68,25 +68,28 @@ public:
   //Return interpolated second derivative w.r.t C
   virtual Real thermodynamic_factor_C(const Real & _xB, const Real & _xC) const;
 
+  //Return all the above properties with a single search of the table
+  virtual void all_properties(const Real & _xB, const Real & _xC,
+                              Real & f_energy,
+                              Real & B_diff_pot, Real & C_diff_pot,
+                              Real & therm_factor_B, Real & therm_factor_BC,
+                              Real & therm_factor_C) const;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element, with values[p*n + q] holding property p at point q
+  void evaluate(unsigned int n, const Real * xB, const Real * xC,
+                std::vector<Real> & values) const;
+
 private:
 
-    //Code based on PiecewiseBilinear
-    std::unique_ptr<BilinearInterpolation> _interpolate_Gm, 
-                                           _interpolate_chem_pot_A,
-                                           _interpolate_chem_pot_B,
-                                           _interpolate_chem_pot_C,
-                                           _interpolate_therm_factor_B,
-                                           _interpolate_therm_factor_BC,
-                                           _interpolate_therm_factor_C;
+    //All the properties are interpolated together on the (xB, xC) grid
+    std::unique_ptr<MultiFieldBilinearInterpolation> _interpolate_properties;
    
     //variable to hold the string type table name from input file
     FileName _table_name; 
     
     std::vector<Real> _xB, _xC;
     
-    ColumnMajorMatrix _GmMatrix, _chemAMatrix, _chemBMatrix, _chemCMatrix,
-                      _tfactorBMatrix, _tfactorBCMatrix, _tfactorCMatrix;
-    
     //Moose utility csv_reader defined for reading the table
     //Note that DelimitedFileReader is a class defined within 
     // a namespace MoseUtils and hence to create object
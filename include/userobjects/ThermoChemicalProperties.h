@@ -16,6 +16,14 @@ class ThermoChemicalProperties;
 
 //MOOSE inlcudes
 #include "GeneralUserObject.h"
+#include "TabulatedDataFile.h"
+#include "SharedTableWindow.h"
+#include "TableAxis.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 
 template <>
 InputParameters validParams<ThermoChemicalProperties>();
@@ -36,7 +44,193 @@ public:
   
   virtual void initialize() override {};
   virtual void execute() override {};
-  virtual void finalize() override {};
+  virtual void finalize() override;
+
+  //Properties looked up by name, for the objects that provide them (see
+  //TabulatedPhaseDataND and TDBPhaseData): the number of independent
+  //variables and of outputs, the position of an output, and every output at
+  //n points, with x[d][q] variable d of point q and values[o*n + q] output o
+  virtual unsigned int numVariables() const;
+  virtual unsigned int numOutputs() const;
+  virtual unsigned int outputIndex(const std::string & output) const;
+  virtual void
+  evaluateOutputs(unsigned int n, const Real * const * x, std::vector<Real> & values) const;
+
+  //Lookup statistics of this rank, gathered when report_lookups is set (see
+  //TableLookupStatistics): the number of points sampled and the time spent
+  //sampling them in seconds (summed over the threads), and the axes of the
+  //table, which count the cell searches and the values clamped to the table
+  bool reportsLookups() const { return _report_lookups; }
+  std::size_t numSamples() const { return _num_samples.load(std::memory_order_relaxed); }
+  Real lookupTime() const { return 1e-9 * _lookup_ns.load(std::memory_order_relaxed); }
+  std::vector<const TableAxis *> tableAxes() const;
+
+protected:
+  //Count the points sampled and the time taken from the construction to the
+  //destruction of the timer, when report_lookups is set. Declared at the top
+  //of every function of the subclasses that samples the table.
+  class LookupTimer
+  {
+  public:
+    LookupTimer(const ThermoChemicalProperties & properties, unsigned int n)
+      : _properties(properties._report_lookups ? &properties : nullptr)
+    {
+      if (_properties)
+      {
+        _properties->_num_samples.fetch_add(n, std::memory_order_relaxed);
+        _start = std::chrono::steady_clock::now();
+      }
+    }
+
+    ~LookupTimer()
+    {
+      if (_properties)
+        _properties->_lookup_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - _start)
+                .count(),
+            std::memory_order_relaxed);
+    }
+
+  private:
+    const ThermoChemicalProperties * _properties;
+    std::chrono::steady_clock::time_point _start;
+  };
+
+  //Return the image of the table to use in place: the table shared by
+  //the writer of the node, or the binary copy of the table if it exists
+  //and was written from the current text tables (sources).
+  //Returns nullptr if the text table must be read.
+  const TabulatedDataFile * tableImage(const std::vector<FileName> & sources);
+
+  //Report the grid of the table, write its binary copy if it was requested
+  //and does not exist yet, and move the table to the memory of the node if
+  //it is shared
+  template <typename T>
+  void finishTableSetup(std::unique_ptr<T> & interpolation, const FileName & table_name);
+
+  //Report the largest error of each property due to a table stored in
+  //single precision (see MultiFieldTrilinearInterpolation)
+  template <typename T>
+  void reportSinglePrecision(const T & interpolation, const FileName & table_name);
+
+  //Compress the table into an octree if a positive tolerance is given and
+  //report the memory saved (see MultiFieldTrilinearInterpolation::compress())
+  template <typename T>
+  void compressTable(T & interpolation, Real tolerance, const FileName & table_name);
+
+  //variable to hold the name of the binary copy of the table
+  FileName _binary_table_name;
+
+  //Mapped binary table, kept for the lifetime of the interpolation
+  std::unique_ptr<TabulatedDataFile> _binary_table;
+
+  //Fingerprint of the text tables, written in the binary copy
+  std::uint64_t _source_fingerprint = 0;
+
+  //Whether the number of cell searches is reported and the function
+  //returning the counts of the interpolation of the table
+  const bool _report_lookups;
+  std::function<void(std::size_t &, std::size_t &)> _lookup_stats;
+
+  //Function returning the axes of the interpolation of the table
+  std::function<std::vector<const TableAxis *>()> _table_axes;
+
+  //See numSamples() and lookupTime(); updated by the threads of the materials
+  mutable std::atomic<std::size_t> _num_samples{0};
+  mutable std::atomic<std::int64_t> _lookup_ns{0};
+
+  //Memory shared by the ranks of the node and the table it holds
+  std::unique_ptr<SharedTableWindow> _shared_table;
+  std::unique_ptr<TabulatedDataFile> _shared_image;
 
+private:
+  //Whether a binary copy of the table was given and exists
+  bool binaryTableExists() const;
+
+  //Copy the table of the writer to the memory of the node
+  void shareTable(std::size_t size, const std::function<void(void *)> & write_image);
 };
+
+template <typename T>
+void
+ThermoChemicalProperties::finishTableSetup(std::unique_ptr<T> & interpolation,
+                                           const FileName & table_name)
+{
+  _lookup_stats = [&interpolation](std::size_t & hits, std::size_t & misses) {
+    interpolation->lookupStats(hits, misses);
+  };
+  _table_axes = [&interpolation]() {
+    std::vector<const TableAxis *> axes;
+    for (unsigned int d = 0; d < interpolation->numAxes(); ++d)
+      axes.push_back(&interpolation->axis(d));
+    return axes;
+  };
+
+  if (interpolation->isUniform())
+    _console << "Grid points in " << table_name << " are equally spaced: cells are located without a search\n";
+
+  //Only one rank writes the binary table, the others keep the text one for this run
+  if (!_binary_table && !_binary_table_name.empty() && processor_id() == 0)
+  {
+    _console << "Writing binary table " << _binary_table_name << "\n";
+    interpolation->write(_binary_table_name, _source_fingerprint);
+  }
+
+  //The writer of the node rebuilds its interpolation on the shared memory,
+  //so the node holds a single copy of the table
+  if (_shared_table && !_shared_image)
+  {
+    const unsigned int num_fields = interpolation->numFields();
+    shareTable(interpolation->imageSize(),
+               [&interpolation](void * image) { interpolation->writeImage(image); });
+
+    interpolation = libmesh_make_unique<T>(*_shared_image, num_fields);
+    _binary_table.reset();
+  }
+
+  //The axes are final once the table is shared
+  if (_report_lookups)
+    for (unsigned int d = 0; d < interpolation->numAxes(); ++d)
+      interpolation->axis(d).trackVisits();
+}
+
+template <typename T>
+void
+ThermoChemicalProperties::reportSinglePrecision(const T & interpolation,
+                                                const FileName & table_name)
+{
+  if (!interpolation.isSinglePrecision())
+    return;
+
+  _console << "Values in " << table_name << " are stored in single precision";
+
+  //The error is only known when the table was read in double
+  const std::vector<Real> & error = interpolation.singlePrecisionError();
+  if (!error.empty())
+  {
+    _console << "; largest interpolation error of each property:";
+    for (const Real & e : error)
+      _console << " " << e;
+  }
+
+  _console << "\n";
+}
+
+template <typename T>
+void
+ThermoChemicalProperties::compressTable(T & interpolation,
+                                        Real tolerance,
+                                        const FileName & table_name)
+{
+  if (tolerance <= 0.0)
+    return;
+
+  const std::size_t full_size = interpolation.storageSize();
+  interpolation.compress(tolerance);
+
+  _console << "Compressed " << table_name << " into " << interpolation.numLeaves()
+           << " boxes: " << interpolation.storageSize() << " bytes instead of " << full_size
+           << "\n";
+}
 //#endif //THERMOCHEMICALPROPERTIES_H
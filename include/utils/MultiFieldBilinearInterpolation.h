@@ -0,0 +1,88 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "TableAxis.h"
+#include "TabulatedDataFile.h"
+
+//MultiFieldBilinearInterpolation interpolates several properties that are
+//tabulated on the same (x1, x2) grid. Unlike one BilinearInterpolation per
+//property, the values of all the properties are stored together for each
+//grid node, so the cell is searched once and the four corner nodes are
+//read from contiguous memory for every property.
+
+class MultiFieldBilinearInterpolation
+{
+public:
+  //x1, x2: sorted and unique grid points
+  //fields[f][i2 + n2*i1]: value of property f at the node (x1[i1], x2[i2]),
+  //i.e. the order of the rows in the tables read by the TernaryPhaseData classes
+  MultiFieldBilinearInterpolation(const std::vector<Real> & x1,
+                                  const std::vector<Real> & x2,
+                                  const std::vector<std::vector<Real>> & fields);
+
+  //Use the values of a binary table in place; the table must outlive this object
+  MultiFieldBilinearInterpolation(const TabulatedDataFile & table, unsigned int num_fields);
+
+  MultiFieldBilinearInterpolation(const MultiFieldBilinearInterpolation &) = delete;
+
+  //Number of properties stored per grid node
+  unsigned int numFields() const { return _num_fields; }
+
+  //Whether the cells are located without a search along both axes
+  bool isUniform() const { return _x1.isUniform() && _x2.isUniform(); }
+
+  //Grid of axis d (0: s1, 1: s2)
+  unsigned int numAxes() const { return 2; }
+  const TableAxis & axis(unsigned int d) const { return d == 0 ? _x1 : _x2; }
+
+  //Interpolate every property at (s1, s2); values must hold numFields() entries
+  void sampleAll(const Real & s1, const Real & s2, Real * values) const;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element: values[f*n + q] holds property f at (s1[q], s2[q]). The values
+  //are grouped by property so that the loops over the points vectorise.
+  void sampleAll(unsigned int n, const Real * s1, const Real * s2, Real * values) const;
+
+  //Interpolate a single property at (s1, s2)
+  Real sample(const Real & s1, const Real & s2, unsigned int field) const;
+
+  //Interpolate property field minus property reference at (s1, s2), with a
+  //single search of the cell (e.g. a diffusion potential from two chemical
+  //potentials)
+  Real sampleDifference(const Real & s1,
+                        const Real & s2,
+                        unsigned int field,
+                        unsigned int reference) const;
+
+  //Write the grid and the values as a binary table, with the fingerprint
+  //of the text table they were read from
+  void write(const std::string & file_name, std::uint64_t source = 0) const;
+
+  //Searches of the non-uniform axes that found the last cell of the
+  //thread or a neighbour (hits) and that did not (misses)
+  void lookupStats(std::size_t & hits, std::size_t & misses) const;
+
+  //Size in bytes of the binary table and its image written in memory
+  std::size_t imageSize() const;
+  void writeImage(void * image) const;
+
+private:
+  TableAxis _x1, _x2;
+
+  unsigned int _num_fields;
+
+  //Values read from a text table
+  std::vector<Real> _values;
+
+  //Interleaved values: _data[(i2 + n2*i1)*_num_fields + f], either _values or a binary table
+  const Real * _data;
+};
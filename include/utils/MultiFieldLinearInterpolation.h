@@ -0,0 +1,72 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "TableAxis.h"
+#include "TabulatedDataFile.h"
+
+//MultiFieldLinearInterpolation interpolates several properties that are
+//tabulated on the same 1-D grid (the Binary*Data tables). The values of all
+//the properties are stored together for each grid point, so the interval
+//is located once for all of them.
+
+class MultiFieldLinearInterpolation
+{
+public:
+  //x: sorted and unique grid points
+  //fields[f][i]: value of property f at x[i]
+  MultiFieldLinearInterpolation(const std::vector<Real> & x,
+                                const std::vector<std::vector<Real>> & fields);
+
+  //Use the values of a binary table in place; the table must outlive this object
+  MultiFieldLinearInterpolation(const TabulatedDataFile & table, unsigned int num_fields);
+
+  MultiFieldLinearInterpolation(const MultiFieldLinearInterpolation &) = delete;
+
+  //Number of properties stored per grid point
+  unsigned int numFields() const { return _num_fields; }
+
+  //Whether the interval is located without a search
+  bool isUniform() const { return _x.isUniform(); }
+
+  //Grid of the independent variable (d must be 0)
+  unsigned int numAxes() const { return 1; }
+  const TableAxis & axis(unsigned int) const { return _x; }
+
+  //Interpolate every property at s; values must hold numFields() entries
+  void sampleAll(const Real & s, Real * values) const;
+
+  //Interpolate a single property at s
+  Real sample(const Real & s, unsigned int field) const;
+
+  //Write the grid and the values as a binary table, with the fingerprint
+  //of the text table they were read from
+  void write(const std::string & file_name, std::uint64_t source = 0) const;
+
+  //Searches of the non-uniform axes that found the last cell of the
+  //thread or a neighbour (hits) and that did not (misses)
+  void lookupStats(std::size_t & hits, std::size_t & misses) const;
+
+  //Size in bytes of the binary table and its image written in memory
+  std::size_t imageSize() const;
+  void writeImage(void * image) const;
+
+private:
+  TableAxis _x;
+
+  unsigned int _num_fields;
+
+  //Values read from a text table
+  std::vector<Real> _values;
+
+  //Interleaved values: _data[i*_num_fields + f], either _values or a binary table
+  const Real * _data;
+};
@@ -0,0 +1,293 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+//MOOSE includes
+#include "TableAxis.h"
+#include "TabulatedDataFile.h"
+#include "MooseError.h"
+
+#include <algorithm>
+#include <array>
+
+//Cell of an N-D table containing a sample point: the index of its lower
+//corner node and the multilinear weights of its 2^N corners
+template <unsigned int N>
+struct MultilinearCell
+{
+  static const unsigned int num_corners = 1u << N;
+
+  unsigned int node;
+  Real weight[num_corners];
+};
+
+//MultiFieldMultilinearInterpolation interpolates several properties that are
+//tabulated on the same grid of N independent variables. It is the N-D form of
+//MultiFieldTrilinearInterpolation with the same storage (one contiguous block
+//per property, the last variable varying fastest); the number of variables
+//is a template argument so that the loops over the axes and over the corners
+//of a cell have a fixed length and are unrolled by the compiler.
+
+template <unsigned int N>
+class MultiFieldMultilinearInterpolation
+{
+public:
+  static_assert(N >= 1 && N <= TabulatedDataFile::max_axes,
+                "MultiFieldMultilinearInterpolation: unsupported number of axes");
+
+  typedef MultilinearCell<N> Cell;
+
+  //axes[d]: sorted and unique grid points of variable d
+  //fields[f][node]: value of property f at a node, numbered with the last
+  //variable varying fastest
+  MultiFieldMultilinearInterpolation(const std::array<std::vector<Real>, N> & axes,
+                                     const std::vector<std::vector<Real>> & fields);
+
+  //Use the values of a binary table in place; the table must outlive this object
+  MultiFieldMultilinearInterpolation(const TabulatedDataFile & table, unsigned int num_fields);
+
+  MultiFieldMultilinearInterpolation(const MultiFieldMultilinearInterpolation &) = delete;
+
+  //Number of properties stored on the grid
+  unsigned int numFields() const { return _num_fields; }
+
+  //Whether the cells are located without a search along every axis
+  bool isUniform() const
+  {
+    for (unsigned int d = 0; d < N; ++d)
+      if (!_axes[d].isUniform())
+        return false;
+    return true;
+  }
+
+  //Grid of axis d
+  unsigned int numAxes() const { return N; }
+  const TableAxis & axis(unsigned int d) const { return _axes[d]; }
+
+  //Find the cell containing the point x[0..N-1] and the weights of its corners
+  void locate(const Real * x, Cell & cell) const
+  {
+    unsigned int node = 0;
+    Real w[N];
+    for (unsigned int d = 0; d < N; ++d)
+    {
+      unsigned int i;
+      _axes[d].locate(x[d], i, w[d]);
+      node = node * _axes[d].size() + i;
+    }
+    cell.node = node;
+
+    //Corner c takes the upper point of axis d when bit N-1-d of c is set,
+    //which is the order of _corner_offset
+    cell.weight[0] = 1.0;
+    for (unsigned int d = 0; d < N; ++d)
+      for (unsigned int c = (1u << d); c-- > 0;)
+      {
+        cell.weight[2 * c + 1] = cell.weight[c] * w[d];
+        cell.weight[2 * c] = cell.weight[c] * (1.0 - w[d]);
+      }
+  }
+
+  //Interpolate property field in a cell found by locate()
+  Real sample(const Cell & cell, unsigned int field) const
+  {
+    const Real * v = &_data[field * _num_nodes + cell.node];
+
+    Real value = 0.0;
+    for (unsigned int c = 0; c < Cell::num_corners; ++c)
+      value += cell.weight[c] * v[_corner_offset[c]];
+
+    return value;
+  }
+
+  //Interpolate every property at x; values must hold numFields() entries
+  void sampleAll(const Real * x, Real * values) const
+  {
+    Cell cell;
+    locate(x, cell);
+
+    for (unsigned int f = 0; f < _num_fields; ++f)
+      values[f] = sample(cell, f);
+  }
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element: x[d][q] is variable d of point q and values[f*n + q] holds
+  //property f at point q
+  void sampleAll(unsigned int n, const Real * const * x, Real * values) const;
+
+  //Interpolate a single property at x
+  Real sample(const Real * x, unsigned int field) const
+  {
+    Cell cell;
+    locate(x, cell);
+
+    return sample(cell, field);
+  }
+
+  //Write the grid and the values as a binary table, with the fingerprint
+  //of the text table they were read from
+  void write(const std::string & file_name, std::uint64_t source = 0) const
+  {
+    TabulatedDataFile::write(file_name, axisPoints(), _num_fields, _data, source);
+  }
+
+  //Searches of the non-uniform axes that found the last cell of the
+  //thread or a neighbour (hits) and that did not (misses)
+  void lookupStats(std::size_t & hits, std::size_t & misses) const
+  {
+    hits = misses = 0;
+    for (unsigned int d = 0; d < N; ++d)
+    {
+      hits += _axes[d].hits();
+      misses += _axes[d].misses();
+    }
+  }
+
+  //Size in bytes of the binary table and its image written in memory
+  std::size_t imageSize() const { return TabulatedDataFile::imageSize(axisPoints(), _num_fields); }
+  void writeImage(void * image) const
+  {
+    TabulatedDataFile::writeImage(image, axisPoints(), _num_fields, _data);
+  }
+
+private:
+  std::array<TableAxis, N> _axes;
+
+  unsigned int _num_fields;
+  unsigned int _num_nodes;
+
+  //Offset of each corner of a cell from its lower corner node
+  unsigned int _corner_offset[Cell::num_corners];
+
+  //Values read from a text table
+  std::vector<Real> _values;
+
+  //Values of the properties: _data[f*_num_nodes + node], either _values or a binary table
+  const Real * _data;
+
+  //Number of nodes and offsets of the corners of a cell, once the grid is known
+  void setGrid();
+
+  //Grid points of every axis, as written to the binary table
+  std::vector<std::vector<Real>> axisPoints() const
+  {
+    std::vector<std::vector<Real>> points;
+    for (unsigned int d = 0; d < N; ++d)
+      points.push_back(_axes[d].points());
+    return points;
+  }
+};
+
+template <unsigned int N>
+MultiFieldMultilinearInterpolation<N>::MultiFieldMultilinearInterpolation(
+    const std::array<std::vector<Real>, N> & axes, const std::vector<std::vector<Real>> & fields)
+  : _num_fields(fields.size())
+{
+  for (unsigned int d = 0; d < N; ++d)
+    _axes[d] = TableAxis(axes[d]);
+
+  setGrid();
+
+  _values.resize(_num_fields * _num_nodes);
+
+  for (unsigned int f = 0; f < _num_fields; ++f)
+  {
+    if (fields[f].size() != _num_nodes)
+      mooseError("MultiFieldMultilinearInterpolation: property ",
+                 f,
+                 " has ",
+                 fields[f].size(),
+                 " values, but the grid has ",
+                 _num_nodes,
+                 " nodes");
+
+    std::copy(fields[f].begin(), fields[f].end(), _values.begin() + f * _num_nodes);
+  }
+
+  _data = _values.data();
+}
+
+template <unsigned int N>
+MultiFieldMultilinearInterpolation<N>::MultiFieldMultilinearInterpolation(
+    const TabulatedDataFile & table, unsigned int num_fields)
+  : _num_fields(num_fields), _data(table.values())
+{
+  if (table.numAxes() != N || table.numFields() != _num_fields)
+    mooseError("MultiFieldMultilinearInterpolation: the binary table has ",
+               table.numAxes(),
+               " axes and ",
+               table.numFields(),
+               " properties, but ",
+               N,
+               " axes and ",
+               _num_fields,
+               " properties are expected");
+
+  for (unsigned int d = 0; d < N; ++d)
+    _axes[d] = TableAxis(table.axis(d));
+
+  setGrid();
+}
+
+template <unsigned int N>
+void
+MultiFieldMultilinearInterpolation<N>::setGrid()
+{
+  //stride[d]: distance between two nodes along axis d
+  unsigned int stride[N];
+  _num_nodes = 1;
+  for (unsigned int d = N; d-- > 0;)
+  {
+    stride[d] = _num_nodes;
+    _num_nodes *= _axes[d].size();
+  }
+
+  for (unsigned int c = 0; c < Cell::num_corners; ++c)
+  {
+    _corner_offset[c] = 0;
+    for (unsigned int d = 0; d < N; ++d)
+      _corner_offset[c] += ((c >> (N - 1 - d)) & 1) * stride[d];
+  }
+}
+
+template <unsigned int N>
+void
+MultiFieldMultilinearInterpolation<N>::sampleAll(unsigned int n,
+                                                 const Real * const * x,
+                                                 Real * values) const
+{
+  //The cells are located for a block of points, then each property is
+  //interpolated over the whole block
+  const unsigned int block = 64;
+  Cell cells[block];
+
+  for (unsigned int begin = 0; begin < n; begin += block)
+  {
+    const unsigned int m = std::min(block, n - begin);
+
+    for (unsigned int q = 0; q < m; ++q)
+    {
+      Real point[N];
+      for (unsigned int d = 0; d < N; ++d)
+        point[d] = x[d][begin + q];
+
+      locate(point, cells[q]);
+    }
+
+    for (unsigned int f = 0; f < _num_fields; ++f)
+    {
+      Real * out = values + f * n + begin;
+
+      for (unsigned int q = 0; q < m; ++q)
+        out[q] = sample(cells[q], f);
+    }
+  }
+}
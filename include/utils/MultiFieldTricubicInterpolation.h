@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+
+#pragma once
+
+//MOOSE includes
+#include "MultiFieldTrilinearInterpolation.h"
+
+//Cell of a 3-D table containing a sample point, with the 4x4x4 nodes around
+//it: along each axis the offsets of the nodes i-1 .. i+2 in the storage of
+//the table, their weights in the interpolated value and in its derivative
+struct TricubicCell
+{
+  unsigned int offset[3][4];
+  Real weight[3][4];
+  Real dweight[3][4];
+};
+
+//MultiFieldTricubicInterpolation is a piecewise tricubic Hermite interpolation
+//of the properties stored by a MultiFieldTrilinearInterpolation, which it uses
+//in place (the table must outlive this object). The derivatives at the nodes
+//are finite differences of the tabulated values (second order, also on
+//non-uniform grids, and one-sided at the ends of an axis), so no more data is
+//needed than for the trilinear interpolation. The interpolated values are
+//continuous with continuous first derivatives, and sample() returns the exact
+//gradient of the interpolated value, so that a property and its derivatives
+//are consistent. Outside the table the value is clamped as in the trilinear
+//interpolation and its derivative along the clamped axis is zero.
+
+class MultiFieldTricubicInterpolation
+{
+public:
+  MultiFieldTricubicInterpolation(const MultiFieldTrilinearInterpolation & table);
+
+  MultiFieldTricubicInterpolation(const MultiFieldTricubicInterpolation &) = delete;
+
+  //Find the nodes around (x, y, z) and their weights
+  void locate(const Real & x, const Real & y, const Real & z, TricubicCell & cell) const;
+
+  //Interpolate property field in a cell found by locate(); gradient[d] is
+  //its derivative with respect to variable d
+  Real sample(const TricubicCell & cell, unsigned int field, Real * gradient) const;
+
+private:
+  //Interpolate the values v of a property, in double or in single precision
+  template <typename T>
+  Real sample(const TricubicCell & cell, const T * v, Real * gradient) const;
+
+  //Weights of the nodes i-1 .. i+2 along axis d of the cell containing x
+  void axisWeights(unsigned int d, const Real & x, TricubicCell & cell) const;
+
+  const MultiFieldTrilinearInterpolation & _table;
+
+  //Distance in the storage between two nodes along each axis, and number of nodes
+  unsigned int _stride[3];
+  unsigned int _num_nodes;
+};
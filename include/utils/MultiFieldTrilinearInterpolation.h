@@ -0,0 +1,213 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "TableAxis.h"
+#include "TabulatedDataFile.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+//Cell of a 3-D table containing a sample point: the index of its lower
+//corner node (of its leaf in a compressed table) and the trilinear weights
+//of its eight corners
+struct TrilinearCell
+{
+  unsigned int node;
+  Real weight[8];
+};
+
+//MultiFieldTrilinearInterpolation interpolates several properties that are
+//tabulated on the same (x, y, z) grid. The cell containing a point is located
+//once (see locate()) and can then be used to sample any number of properties.
+//Each property is stored in its own contiguous block (structure of arrays)
+//in the node order of the tables read by the Quaternary*Data classes.
+//The values may be stored in single precision to halve the memory and the
+//bandwidth of large tables; they are always interpolated in double.
+//Large tables can also be compressed into an octree (see compress()): boxes
+//of cells are merged wherever the properties are close to trilinear over the
+//box, so that only the region where they curve strongly keeps the resolution
+//of the grid. The cell of a point is then the leaf box of the tree containing it.
+
+class MultiFieldTrilinearInterpolation
+{
+public:
+  //x, y, z: sorted and unique grid points
+  //fields[f][k + nz*(j + ny*i)]: value of property f at the node (x[i], y[j], z[k])
+  //single_precision: store the values as float
+  MultiFieldTrilinearInterpolation(const std::vector<Real> & x,
+                                   const std::vector<Real> & y,
+                                   const std::vector<Real> & z,
+                                   const std::vector<std::vector<Real>> & fields,
+                                   bool single_precision = false);
+
+  //Use the values of a binary table in place; the table must outlive this object
+  MultiFieldTrilinearInterpolation(const TabulatedDataFile & table, unsigned int num_fields);
+
+  MultiFieldTrilinearInterpolation(const MultiFieldTrilinearInterpolation &) = delete;
+
+  //Number of properties stored on the grid
+  unsigned int numFields() const { return _num_fields; }
+
+  //Whether the cells are located without a search along every axis
+  bool isUniform() const { return _x.isUniform() && _y.isUniform() && _z.isUniform(); }
+
+  //Grid of axis d (0: x, 1: y, 2: z)
+  unsigned int numAxes() const { return 3; }
+  const TableAxis & axis(unsigned int d) const { return d == 0 ? _x : (d == 1 ? _y : _z); }
+
+  //The stored values (see _data), either in double or in single precision
+  bool isSinglePrecision() const { return _single_data; }
+  const Real * data() const { return _data; }
+  const float * singleData() const { return _single_data; }
+
+  //Largest difference of each property between the values given to the
+  //constructor and the values stored in single precision; it bounds the
+  //interpolation error due to the precision because the interpolated values
+  //are weighted averages of the stored ones. Empty when the values are
+  //stored in double or were read from a binary table.
+  const std::vector<Real> & singlePrecisionError() const { return _single_precision_error; }
+
+  //Replace the grid by an octree of boxes of cells, refined until the trilinear
+  //interpolation over each box differs from the tabulated values by at most
+  //tolerance times the range of each property (or by the round-off of its
+  //values for a property constant over the table). The interpolation then differs
+  //from the one of the full grid by at most this much anywhere (both are
+  //trilinear over each cell), and by twice as much across the faces shared
+  //by boxes of different sizes. The values are kept in double.
+  void compress(Real tolerance);
+
+  //Whether the table was compressed, the number of leaf boxes of the octree,
+  //and the memory used by the values (and the tree) in bytes
+  bool isCompressed() const { return !_leaf_vertices.empty(); }
+  std::size_t numLeaves() const { return _leaf_vertices.size() / 8; }
+  std::size_t storageSize() const;
+
+  //Find the cell containing (x, y, z) and the weights of its corners
+  void locate(const Real & x, const Real & y, const Real & z, TrilinearCell & cell) const;
+
+  //Interpolate property field in a cell found by locate()
+  Real sample(const TrilinearCell & cell, unsigned int field) const
+  {
+    if (isCompressed())
+    {
+      const std::uint32_t * vertex = &_leaf_vertices[8 * cell.node];
+
+      Real value = 0.0;
+      for (unsigned int c = 0; c < 8; ++c)
+        value += cell.weight[c] * _vertex_values[vertex[c] * _num_fields + field];
+
+      return value;
+    }
+
+    if (_single_data)
+      return sample(cell, &_single_data[field * _num_nodes + cell.node]);
+
+    return sample(cell, &_data[field * _num_nodes + cell.node]);
+  }
+
+  //Interpolate every property at (x, y, z); values must hold numFields() entries
+  void sampleAll(const Real & x, const Real & y, const Real & z, Real * values) const;
+
+  //Interpolate every property at n points, e.g. the quadrature points of an
+  //element: values[f*n + q] holds property f at (x[q], y[q], z[q]). The values
+  //are grouped by property so that the loops over the points vectorise.
+  void sampleAll(unsigned int n, const Real * x, const Real * y, const Real * z, Real * values) const;
+
+  //Interpolate a single property at (x, y, z)
+  Real sample(const Real & x, const Real & y, const Real & z, unsigned int field) const;
+
+  //Write the grid and the values as a binary table, with the fingerprint
+  //of the text table they were read from
+  void write(const std::string & file_name, std::uint64_t source = 0) const;
+
+  //Searches of the non-uniform axes that found the last cell of the
+  //thread or a neighbour (hits) and that did not (misses)
+  void lookupStats(std::size_t & hits, std::size_t & misses) const;
+
+  //Size in bytes of the binary table and its image written in memory
+  std::size_t imageSize() const;
+  void writeImage(void * image) const;
+
+private:
+  TableAxis _x, _y, _z;
+
+  unsigned int _num_fields;
+  unsigned int _num_nodes;
+
+  //Offset of each corner of a cell from its lower corner node
+  unsigned int _corner_offset[8];
+
+  //Values read from a text table, in double or in single precision
+  std::vector<Real> _values;
+  std::vector<float> _single_values;
+
+  //Values of the properties: _data[f*_num_nodes + node], either _values or a binary
+  //table; in single precision _data is null and _single_data holds the values
+  const Real * _data = nullptr;
+  const float * _single_data = nullptr;
+
+  //See singlePrecisionError()
+  std::vector<Real> _single_precision_error;
+
+  //Interpolate the values of a property starting at the lower corner of the cell
+  template <typename T>
+  Real sample(const TrilinearCell & cell, const T * v) const
+  {
+    Real value = 0.0;
+    for (unsigned int c = 0; c < 8; ++c)
+      value += cell.weight[c] * v[_corner_offset[c]];
+
+    return value;
+  }
+
+  //Offsets of the corners of a cell, once the grid is known
+  void setCornerOffsets();
+
+  //Octrees of a compressed table. The grid is first divided into blocks of
+  //_block_size cells along each axis, each the root of a tree, so that a point
+  //is found in a few levels. Each node splits its box of cells in two along
+  //every axis with more than one cell; _tree holds, for each node, the index
+  //of its first child (the children are contiguous) or, for a leaf, its index
+  //with _leaf_flag set. The roots are the first nodes, in the order of the blocks.
+  std::vector<std::uint32_t> _tree;
+  static const std::uint32_t _leaf_flag = 0x80000000u;
+  static const unsigned int _block_size = 16;
+  unsigned int _num_blocks[3];
+
+  //Vertices of the eight corners of each leaf and the values of every
+  //property at each vertex: _vertex_values[vertex*_num_fields + f]
+  std::vector<std::uint32_t> _leaf_vertices;
+  std::vector<Real> _vertex_values;
+
+  //Build the subtree of the box of nodes lo .. hi into _tree[slot]; vertices
+  //maps the nodes of the grid already used as corners to their vertex
+  void buildOctree(const unsigned int * lo,
+                   const unsigned int * hi,
+                   std::size_t slot,
+                   const std::vector<Real> & tolerance,
+                   std::unordered_map<unsigned int, std::uint32_t> & vertices);
+
+  //Whether the trilinear interpolation from the corners of the box lo .. hi
+  //is within tolerance of every node of the box
+  bool fitsBox(const unsigned int * lo,
+               const unsigned int * hi,
+               const std::vector<Real> & tolerance) const;
+
+  //Find the leaf containing cell (i, j, k) and the weights of its corners
+  void locateLeaf(const unsigned int * cell_index, const Real * point, TrilinearCell & cell) const;
+
+  //Value of property field at a node of the grid, before compress()
+  Real nodeValue(unsigned int field, unsigned int node) const
+  {
+    return _data ? _data[field * _num_nodes + node] : _single_data[field * _num_nodes + node];
+  }
+};
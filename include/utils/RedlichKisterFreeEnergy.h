@@ -0,0 +1,75 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "MooseTypes.h"
+
+#include <vector>
+
+//RedlichKisterFreeEnergy evaluates the molar Gibbs energy of a substitutional
+//solution phase with up to max_components components,
+//  G = sum_i x_i G_i + RT sum_i x_i ln(x_i)
+//    + sum_{i<j} x_i x_j sum_k L^k_ij (x_i - x_j)^k + sum_{i<j<l} x_i x_j x_l L_ijl,
+//i.e. the Redlich-Kister expansion of each binary extrapolated into the
+//multicomponent phase with the Muggianu scheme, and constant ternary terms.
+//Component 0 is the dependent one (x_0 = 1 - sum of the others), as in the
+//tables: the gradient and the Hessian are taken with respect to x_1 .. x_{N-1}
+//and are the diffusion potentials and the thermodynamic factors.
+//The energy and both derivatives are evaluated together: each logarithm is
+//computed once, and each binary polynomial and its two derivatives come from
+//a single Horner pass in (x_i - x_j).
+
+class RedlichKisterFreeEnergy
+{
+public:
+  static const unsigned int max_components = 6;
+
+  //reference[i]: Gibbs energy G_i of pure component i (J/mol)
+  //RT: gas constant times temperature (J/mol)
+  RedlichKisterFreeEnergy(const std::vector<Real> & reference, Real RT);
+
+  //Add L^order_ij to the expansion of the binary i-j (in the order i, j)
+  void addBinary(unsigned int i, unsigned int j, unsigned int order, Real value);
+
+  //Add L_ijl to the ternary term of i, j and l
+  void addTernary(unsigned int i, unsigned int j, unsigned int l, Real value);
+
+  //Number of components, including the dependent one
+  unsigned int numComponents() const { return _reference.size(); }
+
+  //Free energy at the independent mole fractions x[0 .. N-2] (of components
+  //1 .. N-1); gradient and hessian, if not null, receive the N-1 first and
+  //the (N-1)^2 second derivatives (row-major). Mole fractions closer to zero
+  //than min_mole_fraction are moved to it in the logarithms.
+  Real evaluate(const Real * x, Real * gradient, Real * hessian) const;
+
+  //Smallest mole fraction used in the ideal mixing term
+  static constexpr Real min_mole_fraction = 1e-12;
+
+private:
+  std::vector<Real> _reference;
+  Real _RT;
+
+  //Coefficients L^k of the expansion of binary i-j, k = 0 .. size-1
+  struct Binary
+  {
+    unsigned int i, j;
+    std::vector<Real> L;
+  };
+  std::vector<Binary> _binaries;
+
+  struct Ternary
+  {
+    unsigned int i, j, l;
+    Real L;
+  };
+  std::vector<Ternary> _ternaries;
+};
@@ -0,0 +1,72 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "MooseTypes.h"
+#include "libmesh/libmesh_config.h"
+#include "libmesh/parallel.h"
+
+#ifdef LIBMESH_HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include <vector>
+
+//SharedTableWindow holds one copy of a table for all the ranks of a compute
+//node. The ranks of the communicator are grouped by node; the first rank
+//of each node (the writer) allocates an MPI-3 shared-memory window of the
+//size of the table and fills it, the other ranks of the node map the same
+//memory read-only. Without MPI the writer is the only rank and the memory
+//is private.
+
+class SharedTableWindow
+{
+public:
+  //Collective on comm: groups the ranks by node
+  SharedTableWindow(const Parallel::Communicator & comm);
+
+  ~SharedTableWindow();
+
+  SharedTableWindow(const SharedTableWindow &) = delete;
+  SharedTableWindow & operator=(const SharedTableWindow &) = delete;
+
+  //Whether this rank fills the table of its node
+  bool isWriter() const { return _node_rank == 0; }
+
+  //Number of ranks sharing the table
+  unsigned int nodeSize() const { return _node_size; }
+
+  //Collective on the node: the writer allocates size bytes, the other
+  //ranks pass 0 and get the memory of the writer
+  void allocate(std::size_t size);
+
+  //Collective on the node: called by every rank once the writer has
+  //filled the memory, after which the table can be read
+  void sync();
+
+  //Memory of the table and its size in bytes
+  void * data() const { return _data; }
+  std::size_t size() const { return _size; }
+
+private:
+  unsigned int _node_rank;
+  unsigned int _node_size;
+
+  void * _data;
+  std::size_t _size;
+
+#ifdef LIBMESH_HAVE_MPI
+  MPI_Comm _node_comm;
+  MPI_Win _window;
+#else
+  std::vector<char> _memory;
+#endif
+};
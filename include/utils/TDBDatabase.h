@@ -0,0 +1,151 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "MooseTypes.h"
+#include "RedlichKisterFreeEnergy.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+//TDBExpressionGraph holds the temperature expressions of a database as a
+//graph of operations. Identical subexpressions (T, LN(T), powers of T, the
+//GHSER functions shared by many parameters ...) are merged into a single node
+//when they are added, and operations on constants are folded, so that every
+//distinct subexpression is evaluated once per temperature. A node is only
+//added after its operands, so the nodes are evaluated in index order.
+
+class TDBExpressionGraph
+{
+public:
+  enum Operation { CONSTANT, TEMPERATURE, ADD, SUBTRACT, MULTIPLY, DIVIDE, NEGATE, POWER, LOG,
+                   EXP, PIECEWISE };
+
+  TDBExpressionGraph() = default;
+
+  //Nodes of the expressions; each returns the index of the (possibly existing) node
+  unsigned int constant(Real value);
+  unsigned int temperature();
+  unsigned int binary(Operation operation, unsigned int a, unsigned int b);
+  unsigned int unary(Operation operation, unsigned int a);
+  unsigned int power(unsigned int a, Real exponent);
+
+  //Expression pieces[i] between upper[i-1] (or lower) and upper[i]; outside
+  //the range the first or the last piece is extrapolated
+  unsigned int piecewise(Real lower,
+                         const std::vector<Real> & upper,
+                         const std::vector<unsigned int> & pieces);
+
+  //Whether node is a constant, and its value
+  bool isConstant(unsigned int node) const { return _nodes[node].operation == CONSTANT; }
+  Real constantValue(unsigned int node) const { return _nodes[node].value; }
+
+  //Number of distinct nodes
+  std::size_t size() const { return _nodes.size(); }
+
+  //Values of all the nodes at temperature T
+  void evaluate(Real T, std::vector<Real> & values) const;
+
+private:
+  struct Node
+  {
+    Operation operation;
+    //Operands; for PIECEWISE the first piece in _pieces and the number of pieces
+    unsigned int a, b;
+    //Constant, exponent of POWER or lower temperature of PIECEWISE
+    Real value;
+  };
+
+  //Add a node unless an identical one exists; key identifies the node
+  unsigned int addNode(const Node & node, const std::vector<Real> & key);
+
+  std::vector<Node> _nodes;
+  std::map<std::vector<Real>, unsigned int> _node_index;
+
+  //Upper temperature and expression of the pieces of the PIECEWISE nodes
+  std::vector<std::pair<Real, unsigned int>> _pieces;
+};
+
+//TDBDatabase reads the subset of the TDB format of CALPHAD databases needed
+//for substitutional solution phases:
+//  FUNCTION name T0 expression; T1 Y expression; T2 N !
+//  PHASE name type_code 1 sites !
+//  CONSTITUENT name :A,B,C: !
+//  PARAMETER G(phase,A;0) T0 expression; T1 N !        (pure component A)
+//  PARAMETER L(phase,A,B;k) T0 expression; T1 N !      (Redlich-Kister term k of A-B)
+//  PARAMETER L(phase,A,B,C;0) T0 expression; T1 N !    (constant ternary term)
+//Commands end with '!', lines starting with '$' are comments and keywords may
+//be abbreviated to four letters; other commands (ELEMENT, SPECIES,
+//TYPE_DEFINITION ...) are skipped. The expressions may use numbers, T, R,
+//+ - * / **, LN, LOG, EXP and the functions (with or without '#').
+//Phases with several sublattices and parameters other than G and L (e.g.
+//magnetic ones) are not supported and are reported as errors.
+
+class TDBDatabase
+{
+public:
+  //Read the database; names are converted to upper case
+  TDBDatabase(const std::string & file_name);
+
+  //Energy of phase at temperature T, for the given components (the first one
+  //being the dependent one); the parameters involving other species are left out
+  RedlichKisterFreeEnergy
+  phaseEnergy(const std::string & phase, const std::vector<std::string> & components, Real T);
+
+  //Number of distinct nodes of the expressions read so far
+  std::size_t numNodes() const { return _graph.size(); }
+
+private:
+  struct Phase
+  {
+    unsigned int num_sublattices;
+    std::vector<std::string> constituents;
+  };
+
+  struct Parameter
+  {
+    std::string type, phase;
+    std::vector<std::string> constituents;
+    unsigned int order;
+    //Temperature ranges and expressions, parsed when the phase is used
+    std::string expression;
+  };
+
+  //Handle one command of the file
+  void readCommand(const std::string & command);
+
+  //Graph node of a temperature-dependent quantity "T0 expr; T1 Y expr; T2 N ..."
+  unsigned int parsePiecewise(const std::string & text, const std::string & context);
+
+  //Graph node of a function, parsed on first use
+  unsigned int function(const std::string & name);
+
+  //Recursive descent parser of an expression without blanks
+  unsigned int parseSum(const std::string & s, std::size_t & pos, const std::string & context);
+  unsigned int parseProduct(const std::string & s, std::size_t & pos, const std::string & context);
+  unsigned int parsePower(const std::string & s, std::size_t & pos, const std::string & context);
+  unsigned int parsePrimary(const std::string & s, std::size_t & pos, const std::string & context);
+
+  const std::string _file_name;
+
+  TDBExpressionGraph _graph;
+
+  //Text of the functions and their node once parsed
+  std::map<std::string, std::string> _function_text;
+  std::map<std::string, unsigned int> _function_node;
+
+  //Functions being parsed, to report circular definitions
+  std::vector<std::string> _function_stack;
+
+  std::map<std::string, Phase> _phases;
+  std::vector<Parameter> _parameters;
+};
@@ -0,0 +1,145 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+//TableAxis holds the sorted and unique grid points of one independent
+//variable of a tabulated property (mole fraction or diffusion potential)
+//and finds the cell of the grid in which a given value lies.
+//Values outside the axis are clamped to the first or the last point,
+//which is the same behaviour as Linear/Bilinear/TrilinearInterpolation.
+//Tables are usually generated on regularly spaced compositions or
+//potentials; for such axes the cell is computed arithmetically instead
+//of with a binary search. On other axes each thread remembers the last
+//cell it found: consecutive quadrature points and Newton iterations mostly
+//land in the same or a neighbouring cell, so the search hunts outwards
+//from that cell before falling back to a binary search.
+
+class TableAxis
+{
+public:
+  TableAxis() = default;
+
+  //The points must be sorted and unique (see the *PhaseData classes)
+  TableAxis(const std::vector<Real> & points);
+
+  TableAxis(const TableAxis & other);
+  TableAxis & operator=(const TableAxis & other);
+
+  //Number of grid points along this axis
+  unsigned int size() const { return _points.size(); }
+
+  //Return the grid points
+  const std::vector<Real> & points() const { return _points; }
+
+  //Whether the points are equally spaced
+  bool isUniform() const { return _uniform; }
+
+  //Number of searches that found the remembered cell or a neighbour (hits)
+  //and that had to hunt further (misses); uniform axes are not counted, and
+  //nothing is counted unless trackVisits() was called
+  std::size_t hits() const { return _hits.load(std::memory_order_relaxed); }
+  std::size_t misses() const { return _misses.load(std::memory_order_relaxed); }
+
+  //Count the searches and the values located outside the axis (which are
+  //clamped to its ends) and record the range of all the values located.
+  //Off by default, since every search then updates shared counters (see
+  //report_lookups).
+  void trackVisits() const { _track_visits = true; }
+
+  //Number of values below the first and above the last point, and the
+  //smallest and largest values located (+/- infinity before the first one)
+  std::size_t clampedBelow() const { return _clamped_below.load(std::memory_order_relaxed); }
+  std::size_t clampedAbove() const { return _clamped_above.load(std::memory_order_relaxed); }
+  Real visitedMin() const { return _visited_min.load(std::memory_order_relaxed); }
+  Real visitedMax() const { return _visited_max.load(std::memory_order_relaxed); }
+
+  //Given a value x, return the index of the lower grid point of the cell
+  //containing x and the fractional distance of x from that point. A NaN x
+  //gives the first cell with a NaN weight, so that the interpolated values
+  //are NaN and the solver rejects the step.
+  void locate(const Real & x, unsigned int & lower, Real & weight) const
+  {
+    if (_track_visits)
+      recordVisit(x);
+
+    if (std::isnan(x))
+    {
+      lower = 0;
+      weight = x;
+      return;
+    }
+
+    if (x <= _points.front())
+    {
+      lower = 0;
+      weight = 0.0;
+      return;
+    }
+
+    if (x >= _points.back())
+    {
+      lower = _points.size() - 2;
+      weight = 1.0;
+      return;
+    }
+
+    if (_uniform)
+    {
+      //Index from the spacing; the loops only correct round-off in the
+      //tabulated points and run at most once
+      lower = std::min(static_cast<unsigned int>((x - _points.front()) * _inv_spacing),
+                       static_cast<unsigned int>(_points.size() - 2));
+      while (x < _points[lower])
+        --lower;
+      while (x >= _points[lower + 1])
+        ++lower;
+    }
+    else
+      lower = hunt(x);
+
+    weight = (x - _points[lower]) / (_points[lower + 1] - _points[lower]);
+  }
+
+private:
+  //Search the cell of x from the last cell found by this thread
+  unsigned int hunt(const Real & x) const;
+
+  //Last cell found by this thread on this axis
+  unsigned int & lastCell() const;
+
+  //Update the counts and the range of trackVisits()
+  void recordVisit(const Real & x) const;
+
+  std::vector<Real> _points;
+
+  //Equally spaced points and the inverse of their spacing
+  bool _uniform = false;
+  Real _inv_spacing = 0.0;
+
+  //Counts of the searches on non-uniform axes
+  mutable std::atomic<std::size_t> _hits{0};
+  mutable std::atomic<std::size_t> _misses{0};
+
+  //See trackVisits()
+  mutable bool _track_visits = false;
+  mutable std::atomic<std::size_t> _clamped_below{0};
+  mutable std::atomic<std::size_t> _clamped_above{0};
+  mutable std::atomic<Real> _visited_min{std::numeric_limits<Real>::infinity()};
+  mutable std::atomic<Real> _visited_max{-std::numeric_limits<Real>::infinity()};
+};
@@ -0,0 +1,159 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "MooseTypes.h"
+#include "MooseError.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//TabulatedDataFile is a binary copy of a table read by the *PhaseData and
+//*MobilityData classes. The file holds the grid points of each axis followed
+//by the values of the properties, already in the storage order of the
+//MultiField*Interpolation class that writes it. Opening the file maps it
+//read-only into memory, so the values are used in place: neither the time
+//to set up the table nor the memory it needs grows with the size of the
+//text table. The values are written in the byte order of the machine, in
+//double or, for the tables stored in single precision, in float.
+//The same image can also be used from memory shared by the ranks of a node.
+//The header keeps a fingerprint of the text tables the values were read
+//from, so that a binary copy older than its text table is not used.
+
+class TabulatedDataFile
+{
+public:
+  //Largest number of independent variables of a table
+  static const unsigned int max_axes = 5;
+
+  //Map an existing binary table
+  TabulatedDataFile(const std::string & file_name);
+
+  //Use an image of a binary table that is already in memory (not owned)
+  TabulatedDataFile(const void * image, std::size_t size, const std::string & name);
+
+  ~TabulatedDataFile();
+
+  TabulatedDataFile(const TabulatedDataFile &) = delete;
+  TabulatedDataFile & operator=(const TabulatedDataFile &) = delete;
+
+  //Number of independent variables (1 to max_axes)
+  unsigned int numAxes() const { return _header->num_axes; }
+
+  //Number of properties stored on the grid
+  unsigned int numFields() const { return _header->num_fields; }
+
+  //Grid points along axis i
+  std::vector<Real> axis(unsigned int i) const;
+
+  //Fingerprint of the text tables written in the header (see fingerprint())
+  std::uint64_t sourceFingerprint() const { return _header->source_fingerprint; }
+
+  //Fingerprint of the size and the modification time of the given files,
+  //or 0 if one of them cannot be read
+  static std::uint64_t fingerprint(const std::vector<std::string> & file_names);
+
+  //Whether the values are stored in single precision
+  bool isSinglePrecision() const { return _header->value_size == sizeof(float); }
+
+  //Values of the properties in the storage order of the interpolation class,
+  //in double or in single precision
+  const Real * values() const
+  {
+    mooseAssert(!isSinglePrecision(), "The table is stored in single precision");
+    return static_cast<const Real *>(_values);
+  }
+  const float * singleValues() const
+  {
+    mooseAssert(isSinglePrecision(), "The table is stored in double precision");
+    return static_cast<const float *>(_values);
+  }
+
+  //Write a binary table; values holds num_fields values per grid node and
+  //source is the fingerprint of the text tables they were read from
+  static void write(const std::string & file_name,
+                    const std::vector<std::vector<Real>> & axes,
+                    unsigned int num_fields,
+                    const Real * values,
+                    std::uint64_t source = 0);
+  static void write(const std::string & file_name,
+                    const std::vector<std::vector<Real>> & axes,
+                    unsigned int num_fields,
+                    const float * values,
+                    std::uint64_t source = 0);
+
+  //Size in bytes of the image of a binary table with values of value_size bytes
+  static std::size_t imageSize(const std::vector<std::vector<Real>> & axes,
+                               unsigned int num_fields,
+                               std::size_t value_size = sizeof(Real));
+
+  //Write the image of a binary table into memory of imageSize() bytes
+  static void writeImage(void * image,
+                         const std::vector<std::vector<Real>> & axes,
+                         unsigned int num_fields,
+                         const Real * values);
+  static void writeImage(void * image,
+                         const std::vector<std::vector<Real>> & axes,
+                         unsigned int num_fields,
+                         const float * values);
+
+private:
+  struct Header
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t num_axes;
+    std::uint32_t num_fields;
+    std::uint32_t axis_size[max_axes];
+    std::uint32_t value_size;
+    std::uint32_t reserved;
+    std::uint64_t source_fingerprint;
+  };
+
+  //The values that follow the header must stay aligned
+  static_assert(sizeof(Header) % sizeof(Real) == 0, "the header must be a multiple of a Real");
+
+  //Identifies the format and its version (bumped when the layout changes)
+  static const char _magic[8];
+  static const std::uint32_t _version;
+
+  static Header makeHeader(const std::vector<std::vector<Real>> & axes,
+                           unsigned int num_fields,
+                           std::size_t value_size,
+                           std::uint64_t source);
+
+  //Write a table or its image with values of value_size bytes
+  static void writeFile(const std::string & file_name,
+                        const std::vector<std::vector<Real>> & axes,
+                        unsigned int num_fields,
+                        const void * values,
+                        std::size_t value_size,
+                        std::uint64_t source);
+  static void writeImage(void * image,
+                         const std::vector<std::vector<Real>> & axes,
+                         unsigned int num_fields,
+                         const void * values,
+                         std::size_t value_size);
+
+  //Check the header of an image and set the pointers to the points and the values
+  void setImage(const void * image, std::size_t size);
+
+  std::string _file_name;
+
+  //Mapped file, if the image was read from a file
+  void * _map;
+  std::size_t _map_size;
+
+  const Header * _header;
+  const Real * _points;
+  const void * _values;
+};
@@ -0,0 +1,56 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#pragma once
+
+//MOOSE includes
+#include "GeneralVectorPostprocessor.h"
+
+//Forward declarations
+class TableLookupStatistics;
+class ThermoChemicalProperties;
+
+template <>
+InputParameters validParams<TableLookupStatistics>();
+
+//TableLookupStatistics reports the lookups made in the tables of
+//ThermoChemicalProperties objects since the start of the run, summed over
+//the ranks. The vectors samples and time hold the number of points sampled
+//by each object and the time spent sampling them, in the order of
+//table_objects. The other vectors have one row per axis of each table,
+//with the cell searches that found the last cell or not, the values
+//clamped below and above the axis, and the range of the values located
+//next to the range of the axis. The objects must set report_lookups.
+//Objects without a table (TDBPhaseData) have no axis rows.
+
+class TableLookupStatistics : public GeneralVectorPostprocessor
+{
+public:
+  TableLookupStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  std::vector<const ThermoChemicalProperties *> _table_objects;
+
+  VectorPostprocessorValue & _table;
+  VectorPostprocessorValue & _axis;
+  VectorPostprocessorValue & _samples;
+  VectorPostprocessorValue & _time;
+  VectorPostprocessorValue & _hits;
+  VectorPostprocessorValue & _misses;
+  VectorPostprocessorValue & _clamped_below;
+  VectorPostprocessorValue & _clamped_above;
+  VectorPostprocessorValue & _visited_min;
+  VectorPostprocessorValue & _visited_max;
+  VectorPostprocessorValue & _table_min;
+  VectorPostprocessorValue & _table_max;
+};
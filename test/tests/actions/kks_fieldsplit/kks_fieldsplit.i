@@ -0,0 +1,97 @@
+# Linear system with the coupling pattern of a KKS model, solved with the
+# fieldsplit preconditioner set up by [KKSFieldSplit]:
+#   muB - xB - laplacian(muB) = 0
+#   d(xB)/dt + xB - muB/2 = 0
+#   d(eta)/dt - laplacian(eta) + eta - xB = 0
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [muB]
+  []
+  [xB]
+  []
+  [eta]
+  []
+[]
+
+[ICs]
+  [xB]
+    type = FunctionIC
+    variable = xB
+    function = 'x*y'
+  []
+[]
+
+[Kernels]
+  [muB_diff]
+    type = Diffusion
+    variable = muB
+  []
+  [muB_reaction]
+    type = Reaction
+    variable = muB
+  []
+  [muB_xB]
+    type = CoupledForce
+    variable = muB
+    v = xB
+  []
+  [xB_dt]
+    type = TimeDerivative
+    variable = xB
+  []
+  [xB_reaction]
+    type = Reaction
+    variable = xB
+  []
+  [xB_muB]
+    type = CoupledForce
+    variable = xB
+    v = muB
+    coef = 0.5
+  []
+  [eta_dt]
+    type = TimeDerivative
+    variable = eta
+  []
+  [eta_diff]
+    type = Diffusion
+    variable = eta
+  []
+  [eta_reaction]
+    type = Reaction
+    variable = eta
+  []
+  [eta_xB]
+    type = CoupledForce
+    variable = eta
+    v = xB
+  []
+[]
+
+[KKSFieldSplit]
+  diffusion_potentials = 'muB'
+  compositions = 'xB'
+  phase_fields = 'eta'
+  # No external packages needed by the test
+  diffusion_potential_pc = asm
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 2
+  dt = 0.1
+  l_max_its = 100
+  nl_rel_tol = 1e-8
+[]
+
+[Outputs]
+  exodus = true
+[]
@@ -0,0 +1,242 @@
+# Jacobian of the array-variable kernels of a quaternary alloy with three
+# phases. As in ternary_two_phase.i the properties of the phases are tabulated
+# as linear functions of the diffusion potentials.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [x]
+    components = 3
+  []
+  [mu]
+    components = 3
+  []
+  [eta_alpha]
+  []
+  [eta_beta]
+  []
+  [eta_gamma]
+  []
+[]
+
+[Functions]
+  [xB_ic]
+    type = ParsedFunction
+    value = '0.2+0.1*x*y'
+  []
+  [xC_ic]
+    type = ParsedFunction
+    value = '0.3-0.1*x'
+  []
+  [xD_ic]
+    type = ParsedFunction
+    value = '0.1+0.05*y'
+  []
+  [muB_ic]
+    type = ParsedFunction
+    value = 'sin(2*x)+y'
+  []
+  [muC_ic]
+    type = ParsedFunction
+    value = 'x*y-cos(y)'
+  []
+  [muD_ic]
+    type = ParsedFunction
+    value = 'exp(x)-y*y'
+  []
+  [eta_alpha_ic]
+    type = ParsedFunction
+    value = '0.5+0.3*sin(3*x)*y'
+  []
+  [eta_beta_ic]
+    type = ParsedFunction
+    value = '0.6-0.4*x*cos(2*y)'
+  []
+  [eta_gamma_ic]
+    type = ParsedFunction
+    value = '0.3+0.2*x*y'
+  []
+[]
+
+[ICs]
+  [x]
+    type = ArrayFunctionIC
+    variable = x
+    function = 'xB_ic xC_ic xD_ic'
+  []
+  [mu]
+    type = ArrayFunctionIC
+    variable = mu
+    function = 'muB_ic muC_ic muD_ic'
+  []
+  [eta_alpha]
+    type = FunctionIC
+    variable = eta_alpha
+    function = eta_alpha_ic
+  []
+  [eta_beta]
+    type = FunctionIC
+    variable = eta_beta
+    function = eta_beta_ic
+  []
+  [eta_gamma]
+    type = FunctionIC
+    variable = eta_gamma
+    function = eta_gamma_ic
+  []
+[]
+
+[Kernels]
+  [x_dt]
+    type = ArrayTimeDerivative
+    variable = x
+    time_derivative_coefficient = one
+  []
+  [x_continuity]
+    type = ArrayMCContinuityEquation
+    variable = x
+    diff_pot = mu
+    phase_alpha = eta_alpha
+    phase_beta = eta_beta
+    phase_gamma = eta_gamma
+  []
+  [mu_constraint]
+    type = ArrayMCPhaseConstraintMu
+    variable = mu
+    x = x
+    phase_alpha = eta_alpha
+    phase_beta = eta_beta
+    phase_gamma = eta_gamma
+  []
+  [mu_reaction]
+    type = ArrayReaction
+    variable = mu
+    reaction_coefficient = one
+  []
+  [eta_alpha_dt]
+    type = TimeDerivative
+    variable = eta_alpha
+  []
+  [eta_alpha_diff]
+    type = Diffusion
+    variable = eta_alpha
+  []
+  [eta_beta_dt]
+    type = TimeDerivative
+    variable = eta_beta
+  []
+  [eta_beta_diff]
+    type = Diffusion
+    variable = eta_beta
+  []
+  [eta_gamma_dt]
+    type = TimeDerivative
+    variable = eta_gamma
+  []
+  [eta_gamma_diff]
+    type = Diffusion
+    variable = eta_gamma
+  []
+[]
+
+[Materials]
+  [one]
+    type = GenericConstantArray
+    prop_name = one
+    prop_value = '1 1 1'
+  []
+  [interpolation]
+    type = QuantInterpolationFunction
+    phase_alpha = eta_alpha
+    phase_beta = eta_beta
+    phase_gamma = eta_gamma
+  []
+  [alpha]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = alpha
+    table_object = alpha_phase_data
+  []
+  [beta]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = beta
+    table_object = beta_phase_data
+  []
+  [gamma]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = gamma
+    table_object = gamma_phase_data
+  []
+  [alpha_mobility]
+    type = ArrayConjugateKineticMaterial
+    diff_pot = mu
+    phase = alpha
+    table_object = alpha_mobility_data
+  []
+  [beta_mobility]
+    type = ArrayConjugateKineticMaterial
+    diff_pot = mu
+    phase = beta
+    table_object = beta_mobility_data
+  []
+  [gamma_mobility]
+    type = ArrayConjugateKineticMaterial
+    diff_pot = mu
+    phase = gamma
+    table_object = gamma_mobility_data
+  []
+  [diffusivity]
+    type = QuaternaryMultiPhaseDiffusivity
+    h_alpha = h_alpha
+    h_beta = h_beta
+    h_gamma = h_gamma
+  []
+[]
+
+[UserObjects]
+  [alpha_phase_data]
+    type = QuaternaryConjugatePhaseData
+    table_name = quaternary_alpha_phase.txt
+  []
+  [beta_phase_data]
+    type = QuaternaryConjugatePhaseData
+    table_name = quaternary_beta_phase.txt
+  []
+  [gamma_phase_data]
+    type = QuaternaryConjugatePhaseData
+    table_name = quaternary_gamma_phase.txt
+  []
+  [alpha_mobility_data]
+    type = QuaternaryConjugateMobilityData
+    table_name = quaternary_alpha_mobility.txt
+  []
+  [beta_mobility_data]
+    type = QuaternaryConjugateMobilityData
+    table_name = quaternary_beta_mobility.txt
+  []
+  [gamma_mobility_data]
+    type = QuaternaryConjugateMobilityData
+    table_name = quaternary_gamma_mobility.txt
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 1
+  dt = 0.1
+[]
@@ -0,0 +1,193 @@
+# Jacobian of the array-variable kernels of a ternary alloy with two phases.
+# The properties of the phases are tabulated as functions of the array of
+# diffusion potentials: the compositions are linear in mu with a constant
+# positive definite susceptibility and the mobilities are linear in mu, so
+# that the interpolated tables give the exact derivatives.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [x]
+    components = 2
+  []
+  [mu]
+    components = 2
+  []
+  [eta_alpha]
+  []
+  [eta_beta]
+  []
+[]
+
+[Functions]
+  [xB_ic]
+    type = ParsedFunction
+    value = '0.2+0.1*x*y'
+  []
+  [xC_ic]
+    type = ParsedFunction
+    value = '0.3-0.1*x'
+  []
+  [muB_ic]
+    type = ParsedFunction
+    value = 'sin(2*x)+y'
+  []
+  [muC_ic]
+    type = ParsedFunction
+    value = 'x*y-cos(y)'
+  []
+  [eta_alpha_ic]
+    type = ParsedFunction
+    value = '0.5+0.3*sin(3*x)*y'
+  []
+  [eta_beta_ic]
+    type = ParsedFunction
+    value = '0.6-0.4*x*cos(2*y)'
+  []
+[]
+
+[ICs]
+  [x]
+    type = ArrayFunctionIC
+    variable = x
+    function = 'xB_ic xC_ic'
+  []
+  [mu]
+    type = ArrayFunctionIC
+    variable = mu
+    function = 'muB_ic muC_ic'
+  []
+  [eta_alpha]
+    type = FunctionIC
+    variable = eta_alpha
+    function = eta_alpha_ic
+  []
+  [eta_beta]
+    type = FunctionIC
+    variable = eta_beta
+    function = eta_beta_ic
+  []
+[]
+
+[Kernels]
+  [x_dt]
+    type = ArrayTimeDerivative
+    variable = x
+    time_derivative_coefficient = one
+  []
+  [x_continuity]
+    type = ArrayMCContinuityEquation
+    variable = x
+    diff_pot = mu
+    phase_alpha = eta_alpha
+    phase_beta = eta_beta
+  []
+  [mu_constraint]
+    type = ArrayMCPhaseConstraintMu
+    variable = mu
+    x = x
+    phase_alpha = eta_alpha
+    phase_beta = eta_beta
+  []
+  [mu_reaction]
+    type = ArrayReaction
+    variable = mu
+    reaction_coefficient = one
+  []
+  [eta_alpha_dt]
+    type = TimeDerivative
+    variable = eta_alpha
+  []
+  [eta_alpha_diff]
+    type = Diffusion
+    variable = eta_alpha
+  []
+  [eta_beta_dt]
+    type = TimeDerivative
+    variable = eta_beta
+  []
+  [eta_beta_diff]
+    type = Diffusion
+    variable = eta_beta
+  []
+[]
+
+[Materials]
+  [one]
+    type = GenericConstantArray
+    prop_name = one
+    prop_value = '1 1'
+  []
+  [interpolation]
+    type = QuantInterpolationFunction
+    phase_alpha = eta_alpha
+    phase_beta = eta_beta
+  []
+  [alpha]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = alpha
+    table_object = alpha_phase_data
+  []
+  [beta]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = beta
+    table_object = beta_phase_data
+  []
+  [alpha_mobility]
+    type = ArrayConjugateKineticMaterial
+    diff_pot = mu
+    phase = alpha
+    table_object = alpha_mobility_data
+  []
+  [beta_mobility]
+    type = ArrayConjugateKineticMaterial
+    diff_pot = mu
+    phase = beta
+    table_object = beta_mobility_data
+  []
+  [diffusivity]
+    type = TernaryMultiPhaseDiffusivity
+    h_alpha = h_alpha
+    h_beta = h_beta
+  []
+[]
+
+[UserObjects]
+  [alpha_phase_data]
+    type = TernaryConjugatePhaseData
+    table_name = ternary_alpha_phase.txt
+  []
+  [beta_phase_data]
+    type = TernaryConjugatePhaseData
+    table_name = ternary_beta_phase.txt
+  []
+  [alpha_mobility_data]
+    type = TernaryConjugateMobilityData
+    table_name = ternary_alpha_mobility.txt
+  []
+  [beta_mobility_data]
+    type = TernaryConjugateMobilityData
+    table_name = ternary_beta_mobility.txt
+  []
+[]
+
+[Preconditioning]
+  [smp]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 1
+  dt = 0.1
+[]
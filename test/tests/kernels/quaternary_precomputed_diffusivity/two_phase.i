@@ -0,0 +1,229 @@
+# Quaternary alloy with two phases whose continuity equations read the
+# diffusivity computed once per quadrature point. Only dL_dphi_alpha and
+# dL_dphi_beta are declared by the diffusivity material, so the kernels must
+# not request the properties of the phases that are not coupled.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 20
+  xmin = -10
+  xmax = 10
+[]
+
+[Variables]
+  [phi_alpha]
+  []
+  [phi_beta]
+  []
+  [x_B]
+  []
+  [mu_B]
+  []
+  [x_C]
+  []
+  [mu_C]
+  []
+  [x_D]
+  []
+  [mu_D]
+  []
+[]
+
+[Functions]
+  [func_phi_alpha]
+    type = ParsedFunction
+    value = '0.5*(1-tanh(x))'
+  []
+  [func_phi_beta]
+    type = ParsedFunction
+    value = '0.5*(1+tanh(x))'
+  []
+[]
+
+[ICs]
+  [ic_phi_alpha]
+    type = FunctionIC
+    variable = phi_alpha
+    function = func_phi_alpha
+  []
+  [ic_phi_beta]
+    type = FunctionIC
+    variable = phi_beta
+    function = func_phi_beta
+  []
+  [ic_xB]
+    type = ConstantIC
+    variable = x_B
+    value = 0.2
+  []
+  [ic_xC]
+    type = ConstantIC
+    variable = x_C
+    value = 0.15
+  []
+  [ic_xD]
+    type = ConstantIC
+    variable = x_D
+    value = 0.1
+  []
+[]
+
+[Kernels]
+  [PhaseConc_B]
+    type = MCPhaseConstraintMuB
+    variable = mu_B
+    xB = x_B
+    C_diff_pot = mu_C
+    D_diff_pot = mu_D
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+    h_alpha = h_alpha
+    h_beta = h_beta
+  []
+  [PhaseConc_C]
+    type = MCPhaseConstraintMuC
+    variable = mu_C
+    xC = x_C
+    B_diff_pot = mu_B
+    D_diff_pot = mu_D
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+    h_alpha = h_alpha
+    h_beta = h_beta
+  []
+  [PhaseConc_D]
+    type = MCPhaseConstraintMuD
+    variable = mu_D
+    xD = x_D
+    B_diff_pot = mu_B
+    C_diff_pot = mu_C
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+    h_alpha = h_alpha
+    h_beta = h_beta
+  []
+
+  [B_balance]
+    type = MCContinuityEquationB
+    variable = x_B
+    xC = x_C
+    xD = x_D
+    B_diff_pot = mu_B
+    C_diff_pot = mu_C
+    D_diff_pot = mu_D
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+    h_alpha = h_alpha
+    h_beta = h_beta
+    precomputed_diffusivity = true
+  []
+  [xB_dot]
+    type = TimeDerivative
+    variable = x_B
+  []
+  [C_balance]
+    type = MCContinuityEquationC
+    variable = x_C
+    xB = x_B
+    xD = x_D
+    B_diff_pot = mu_B
+    C_diff_pot = mu_C
+    D_diff_pot = mu_D
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+    h_alpha = h_alpha
+    h_beta = h_beta
+    precomputed_diffusivity = true
+  []
+  [xC_dot]
+    type = TimeDerivative
+    variable = x_C
+  []
+  [D_balance]
+    type = MCContinuityEquationD
+    variable = x_D
+    xB = x_B
+    xC = x_C
+    B_diff_pot = mu_B
+    C_diff_pot = mu_C
+    D_diff_pot = mu_D
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+    h_alpha = h_alpha
+    h_beta = h_beta
+    precomputed_diffusivity = true
+  []
+  [xD_dot]
+    type = TimeDerivative
+    variable = x_D
+  []
+
+  #The phase fields only relax, their evolution is not under test
+  [dalpha_dt]
+    type = TimeDerivative
+    variable = phi_alpha
+  []
+  [alpha_diffusion]
+    type = Diffusion
+    variable = phi_alpha
+  []
+  [dbeta_dt]
+    type = TimeDerivative
+    variable = phi_beta
+  []
+  [beta_diffusion]
+    type = Diffusion
+    variable = phi_beta
+  []
+[]
+
+[Materials]
+  [InterpolationFunction]
+    type = QuantInterpolationFunction
+    phase_alpha = phi_alpha
+    phase_beta = phi_beta
+  []
+  [phase_properties]
+    type = GenericConstantMaterial
+    prop_names = 'inv_B_tf_alpha inv_BC_tf_alpha inv_BD_tf_alpha inv_C_tf_alpha inv_CD_tf_alpha
+                  inv_D_tf_alpha L_BB_alpha L_BC_alpha L_BD_alpha L_CC_alpha L_CD_alpha L_DD_alpha
+                  dL_BB_muB_alpha dL_BB_muC_alpha dL_BB_muD_alpha dL_BC_muB_alpha dL_BC_muC_alpha
+                  dL_BC_muD_alpha dL_BD_muB_alpha dL_BD_muC_alpha dL_BD_muD_alpha dL_CC_muB_alpha
+                  dL_CC_muC_alpha dL_CC_muD_alpha dL_CD_muB_alpha dL_CD_muC_alpha dL_CD_muD_alpha
+                  dL_DD_muB_alpha dL_DD_muC_alpha dL_DD_muD_alpha inv_B_tf_beta inv_BC_tf_beta
+                  inv_BD_tf_beta inv_C_tf_beta inv_CD_tf_beta inv_D_tf_beta L_BB_beta L_BC_beta
+                  L_BD_beta L_CC_beta L_CD_beta L_DD_beta dL_BB_muB_beta dL_BB_muC_beta
+                  dL_BB_muD_beta dL_BC_muB_beta dL_BC_muC_beta dL_BC_muD_beta dL_BD_muB_beta
+                  dL_BD_muC_beta dL_BD_muD_beta dL_CC_muB_beta dL_CC_muC_beta dL_CC_muD_beta
+                  dL_CD_muB_beta dL_CD_muC_beta dL_CD_muD_beta dL_DD_muB_beta dL_DD_muC_beta
+                  dL_DD_muD_beta'
+    prop_values = '0.2 -0.02 0.01 0.15 -0.01 0.1 1.0 -0.2 0.1 0.8 -0.05 0.6 0 0 0 0 0 0 0 0 0 0
+                   0 0 0 0 0 0 0 0 0.1 0.01 0 0.12 0.02 0.08 0.3 0.1 0.0 0.5 0.2 0.9 0 0 0 0 0 0
+                   0 0 0 0 0 0 0 0 0 0 0 0'
+  []
+  [phase_compositions]
+    type = GenericConstantMaterial
+    prop_names = 'xB_alpha xC_alpha xD_alpha xB_beta xC_beta xD_beta'
+    prop_values = '0.1 0.2 0.05 0.3 0.1 0.15'
+  []
+  [diffusivity]
+    type = QuaternaryMultiPhaseDiffusivity
+    h_alpha = h_alpha
+    h_beta = h_beta
+  []
+[]
+
+[Preconditioning]
+  [full]
+    type = SMP
+    full = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 2
+  dt = 0.1
+[]
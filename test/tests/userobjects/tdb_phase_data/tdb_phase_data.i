@@ -0,0 +1,69 @@
+# Properties of the FCC phase of Al-Zn read from a TDB database, at 600 K and
+# x_Zn = 0.3. The gold values are the closed forms of the Redlich-Kister model:
+#   GM = -22621.29, mu_Al = -20395.83, diff_pot_Zn = -7418.195, TF_Zn = -669.1771 J/mol
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [xZn]
+    initial_condition = 0.3
+  []
+[]
+
+[UserObjects]
+  [fcc]
+    type = TDBPhaseData
+    tdb_file = al_zn.tdb
+    phase_name = FCC_A1
+    components = 'AL ZN'
+    temp = 600
+  []
+[]
+
+[Materials]
+  [fcc]
+    type = TabulatedPhaseMaterial1D
+    variables = xZn
+    table_object = fcc
+    output_columns = 'GM CHEM_POT_AL DIFF_POT_ZN TF_ZN'
+    property_names = 'G_fcc mu_AL diff_pot_ZN tf_ZN'
+  []
+[]
+
+[Postprocessors]
+  [G_fcc]
+    type = ElementAverageMaterialProperty
+    mat_prop = G_fcc
+  []
+  [mu_AL]
+    type = ElementAverageMaterialProperty
+    mat_prop = mu_AL
+  []
+  [diff_pot_ZN]
+    type = ElementAverageMaterialProperty
+    mat_prop = diff_pot_ZN
+  []
+  [tf_ZN]
+    type = ElementAverageMaterialProperty
+    mat_prop = tf_ZN
+  []
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = tdb_phase_data_out
+    execute_on = timestep_end
+  []
+[]
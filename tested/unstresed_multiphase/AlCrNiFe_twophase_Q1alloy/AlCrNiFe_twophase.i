@@ -1,6 +1,8 @@
 #This input properties are tabulated
 #as functions of independent diffusion potentials
 #That is Al, Cr,and Fe. Molar GP = Ni-chemical potential 
+#The mole fractions and the diffusion potentials of
+#Al, Cr and Fe are solved as array variables
 #This is a model Al-Cr-Ni-Fe alloy problem
 #beta phase is FCC
 #alpha phase is BCC
@@ -35,34 +37,18 @@
   family = LAGRANGE
 [../]
 
-[./x_Al]
-  order = FIRST
-  family = LAGRANGE
-[../]
-
-[./mu_Al]
-  order = FIRST
-  family = LAGRANGE
-[../]
-
-[./x_Cr]
-  order = FIRST
-  family = LAGRANGE
-[../]
-
-[./mu_Cr]
+#Mole fractions of Al, Cr and Fe
+[./x]
   order = FIRST
   family = LAGRANGE
+  components = 3
 [../]
 
-[./x_Fe]
-  order = FIRST
-  family = LAGRANGE
-[../]
-
-[./mu_Fe]
+#Diffusion potentials of Al, Cr and Fe
+[./mu]
   order = FIRST
   family = LAGRANGE
+  components = 3
 [../]
 []
 
@@ -82,26 +68,8 @@
     value = 0
   [../]
   
-   [./MassFluxBC]
-    type = NeumannBC
-    variable = 'mu_Al'
-    boundary = 'left right'
-    value = 0
-  [../]
-
-   [./MassFlux_Cr]
-    type = NeumannBC
-    variable = 'mu_Cr'
-    boundary = 'left right'
-    value = 0
-   [../]
-
-   [./MassFlux_Fe]
-    type = NeumannBC
-    variable = 'mu_Fe'
-    boundary = 'left right'
-    value = 0
-   [../]
+  #No flux of the components is the natural
+  #boundary condition of the continuity equations
  
 []
 
@@ -120,40 +88,16 @@
     function = func_phi_beta
   [../]
   
-  [./ic_xAl]
-   type = FunctionIC
-   variable = x_Al
-   function = func_xAl
+  [./ic_x]
+   type = ArrayFunctionIC
+   variable = x
+   function = 'func_xAl func_xCr func_xFe'
   [../]
   
-  [./muAl_IC]
-   type = FunctionIC
-   variable = mu_Al
-   function = func_muAl
-  [../]
-  
-  [./ic_xCr]
-   type = FunctionIC
-   variable = x_Cr
-   function = func_xCr
-  [../]
-  
-  [./muCr_IC]
-   type = FunctionIC
-   variable = mu_Cr
-   function = func_muCr
-  [../]
-  
-   [./ic_xFe]
-   type = FunctionIC
-   variable = x_Fe
-   function = func_xFe
-  [../]
-  
-  [./muFe_IC]
-   type = FunctionIC
-   variable = mu_Fe
-   function = func_muFe
+  [./ic_mu]
+   type = ArrayFunctionIC
+   variable = mu
+   function = 'func_muAl func_muCr func_muFe'
   [../]
   
 []
@@ -229,114 +173,33 @@
 [Kernels]
   
   #Variable that this kernel operates on
-  #is the diffusion potential of comp B
-  
-  [./PhaseConc_Al]
-    type = MCPhaseConstraintMuB
-    variable = mu_Al
-    xB = x_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot = mu_Fe
-    phase_alpha = phi_alpha
-    phase_beta = phi_beta
-    h_alpha = h_alpha
-    h_beta = h_beta
-  [../]
-  
-  [./PhaseConc_Cr]
-    type = MCPhaseConstraintMuC
-    variable = mu_Cr
-    xC = x_Cr
-    B_diff_pot = mu_Al
-    D_diff_pot = mu_Fe
-    phase_alpha = phi_alpha
-    phase_beta = phi_beta
-    h_alpha = h_alpha
-    h_beta = h_beta
-  [../]
-  
-  [./PhaseConc_Fe]
-    type = MCPhaseConstraintMuD
-    variable = mu_Fe
-    xD = x_Fe
-    C_diff_pot = mu_Cr
-    B_diff_pot = mu_Al
-    phase_alpha = phi_alpha
-    phase_beta = phi_beta
-    h_alpha = h_alpha
-    h_beta = h_beta
-  [../]
-
-  ######################
-  # Diffusion Equation #
-  # Component B        #
-  ######################
-    
-  [./Al_balance]
-    type = MCContinuityEquationB
-    variable = x_Al
-    xC = x_Cr
-    xD = x_Fe
-    B_diff_pot  = mu_Al
-    C_diff_pot  = mu_Cr
-    D_diff_pot  = mu_Fe
-    phase_alpha = phi_alpha
-    phase_beta  = phi_beta
-    h_alpha = h_alpha
-    h_beta = h_beta
-  [../]
-
-  [./xAl_dot]
-    type = TimeDerivative
-    variable = x_Al
-  [../]
+  #is the array of diffusion potentials
   
-  ######################
-  # Diffusion Equation #
-  # Component C        #
-  ######################
-    
-  [./Cr_balance]
-    type = MCContinuityEquationC
-    variable = x_Cr
-    xB = x_Al
-    xD = x_Fe
-    B_diff_pot = mu_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot = mu_Fe
+  [./PhaseConc]
+    type = ArrayMCPhaseConstraintMu
+    variable = mu
+    x = x
     phase_alpha = phi_alpha
     phase_beta = phi_beta
-    h_alpha = h_alpha
-    h_beta = h_beta
   [../]
 
-  [./xCr_dot]
-    type = TimeDerivative
-    variable = x_Cr
-  [../]
-  
   ######################
   # Diffusion Equation #
-  # Component D        #
+  # Components B, C, D #
   ######################
     
-  [./Fe_balance]
-    type = MCContinuityEquationD
-    variable = x_Fe
-    xB = x_Al
-    xC = x_Cr
-    B_diff_pot = mu_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot = mu_Fe
+  [./balance]
+    type = ArrayMCContinuityEquation
+    variable = x
+    diff_pot = mu
     phase_alpha = phi_alpha
     phase_beta = phi_beta
-    h_alpha = h_alpha
-    h_beta = h_beta
   [../]
 
-  [./xFe_dot]
-    type = TimeDerivative
-    variable = x_Fe
+  [./x_dot]
+    type = ArrayTimeDerivative
+    variable = x
+    time_derivative_coefficient = one
   [../]
   
   #######################
@@ -345,20 +208,14 @@
   #######################
   
   [./MultiCompDrivingForce_alpha]
-    type = MultiCompDrivingForce
+    type = ArrayMultiCompDrivingForce
     variable = phi_alpha     #Phase_1
     phase_2 = phi_beta       #Coupled phase_2
-    B_diff_pot = mu_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot  = mu_Fe
+    diff_pot = mu
     A_chem_pot_1 = A_chem_pot_alpha
     A_chem_pot_2 = A_chem_pot_beta
-    xB_1 = xB_alpha
-    xB_2 = xB_beta
-    xC_1 = xC_alpha
-    xC_2 = xC_beta
-    xD_1 = xD_alpha
-    xD_2 = xD_beta
+    x_1 = 'xB_alpha xC_alpha xD_alpha'
+    x_2 = 'xB_beta xC_beta xD_beta'
     dh = dhbeta_dphialpha     #Required by the residual
     d2h = d2hbeta_dphialpha2  #Required by the diag jacobian
     d2h_2 = d2hbeta_dphialpha_dphibeta
@@ -398,21 +255,15 @@
   # for phase-beta      #
   #######################
    
-  [./BinaryMultiPhaseDrivingForce_beta]
-    type = MultiCompDrivingForce
+  [./MultiCompDrivingForce_beta]
+    type = ArrayMultiCompDrivingForce
     variable = phi_beta
     phase_2 = phi_alpha
-    B_diff_pot = mu_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot = mu_Fe
+    diff_pot = mu
     A_chem_pot_1 = A_chem_pot_beta
     A_chem_pot_2 = A_chem_pot_alpha
-    xB_1 = xB_beta
-    xB_2 = xB_alpha
-    xC_1 = xC_beta
-    xC_2 = xC_alpha
-    xD_1 = xD_alpha
-    xD_2 = xD_beta
+    x_1 = 'xB_beta xC_beta xD_beta'
+    x_2 = 'xB_alpha xC_alpha xD_alpha'
     dh = dhalpha_dphibeta
     d2h = d2halpha_dphibeta2
     d2h_2 = d2halpha_dphibeta_dphialpha
@@ -461,74 +312,26 @@
  
  ######################################
  
- [./QuaternaryConjugateKineticMaterial_BCC]
-  type = QuaternaryConjugateKineticMaterial
-  L_BB = L_BB_alpha
-  L_CC = L_CC_alpha
-  L_DD = L_DD_alpha
-  L_BC = L_BC_alpha
-  L_BD = L_BD_alpha
-  L_CD = L_CD_alpha
-  #w.r.t B
-  dL_BB_muB = dL_BB_muB_alpha
-  dL_CC_muB = dL_CC_muB_alpha
-  dL_DD_muB = dL_DD_muB_alpha
-  dL_BC_muB = dL_BC_muB_alpha
-  dL_BD_muB = dL_BD_muB_alpha
-  dL_CD_muB = dL_CD_muB_alpha
-  #w.r.t C
-  dL_BB_muC = dL_BB_muC_alpha
-  dL_BC_muC = dL_BC_muC_alpha
-  dL_BD_muC = dL_BD_muC_alpha
-  dL_CC_muC = dL_CC_muC_alpha
-  dL_CD_muC = dL_CD_muC_alpha
-  dL_DD_muC = dL_DD_muC_alpha
-  #w.r.t D
-  dL_BB_muD = dL_BB_muD_alpha
-  dL_BC_muD = dL_BC_muD_alpha
-  dL_BD_muD = dL_BD_muD_alpha
-  dL_CC_muD = dL_CC_muD_alpha
-  dL_CD_muD = dL_CD_muD_alpha
-  dL_DD_muD = dL_DD_muD_alpha
-  B_diff_pot = mu_Al
-  C_diff_pot = mu_Cr
-  D_diff_pot = mu_Fe
+ [./one]
+   type = GenericConstantArray
+   prop_name = one
+   prop_value = '1 1 1'
+ [../]
+ 
+ ######################################
+ 
+ [./ArrayConjugateKineticMaterial_BCC]
+  type = ArrayConjugateKineticMaterial
+  diff_pot = mu
+  phase = alpha
   table_object = table_BCC_A2_mobility_data
   #outputs = exodus
  [../]
  
- [./QuaternaryConjugateKineticMaterial_FCC]
-  type = QuaternaryConjugateKineticMaterial
-  L_BB = L_BB_beta
-  L_CC = L_CC_beta
-  L_DD = L_DD_beta
-  L_BC = L_BC_beta
-  L_BD = L_BD_beta
-  L_CD = L_CD_beta
-  #w.r.t B
-  dL_BB_muB = dL_BB_muB_beta
-  dL_BC_muB = dL_BC_muB_beta
-  dL_BD_muB = dL_BD_muB_beta
-  dL_CC_muB = dL_CC_muB_beta
-  dL_CD_muB = dL_CD_muB_beta
-  dL_DD_muB = dL_DD_muB_beta
-  #w.r.t C
-  dL_BB_muC = dL_BB_muC_beta
-  dL_BC_muC = dL_BC_muC_beta
-  dL_BD_muC = dL_BD_muC_beta
-  dL_CC_muC = dL_CC_muC_beta
-  dL_CD_muC = dL_CD_muC_beta
-  dL_DD_muC = dL_DD_muC_beta
-  #w.r.t D
-  dL_BB_muD = dL_BB_muD_beta
-  dL_BC_muD = dL_BC_muD_beta
-  dL_BD_muD = dL_BD_muD_beta
-  dL_CC_muD = dL_CC_muD_beta
-  dL_CD_muD = dL_CD_muD_beta
-  dL_DD_muD = dL_DD_muD_beta
-  B_diff_pot = mu_Al
-  C_diff_pot = mu_Cr
-  D_diff_pot = mu_Fe
+ [./ArrayConjugateKineticMaterial_FCC]
+  type = ArrayConjugateKineticMaterial
+  diff_pot = mu
+  phase = beta
   table_object = table_FCC_A1_mobility_data
   #outputs = exodus
  [../]
@@ -539,44 +342,30 @@
    phase_beta = phi_beta
  [../]
   
-  [./QuaternaryConjugatePhaseMaterial_BCC_A2]
-    type = QuaternaryConjugatePhaseMaterial
-    B_diff_pot = mu_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot = mu_Fe
-    A_chem_pot = A_chem_pot_alpha
-    B_mole_fraction = xB_alpha
-    C_mole_fraction = xC_alpha
-    D_mole_fraction = xD_alpha
-    inv_B_tf = inv_B_tf_alpha
-    inv_C_tf = inv_C_tf_alpha
-    inv_D_tf = inv_D_tf_alpha
-    inv_BC_tf = inv_BC_tf_alpha
-    inv_BD_tf = inv_BD_tf_alpha
-    inv_CD_tf = inv_CD_tf_alpha
+  [./ArrayConjugatePhaseMaterial_BCC_A2]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = alpha
     table_object = table_BCC_A2_data
     #outputs =exodus
   [../]
   
-  [./QuaternaryConjugatePhaseMaterial_FCC_A1]
-    type = QuaternaryConjugatePhaseMaterial
-    B_diff_pot = mu_Al
-    C_diff_pot = mu_Cr
-    D_diff_pot = mu_Fe
-    A_chem_pot = A_chem_pot_beta
-    B_mole_fraction = xB_beta
-    C_mole_fraction = xC_beta
-    D_mole_fraction = xD_beta
-    inv_B_tf = inv_B_tf_beta
-    inv_C_tf = inv_C_tf_beta
-    inv_D_tf = inv_D_tf_beta
-    inv_BC_tf = inv_BC_tf_beta
-    inv_BD_tf = inv_BD_tf_beta
-    inv_CD_tf = inv_CD_tf_beta
+  [./ArrayConjugatePhaseMaterial_FCC_A1]
+    type = ArrayConjugatePhaseMaterial
+    diff_pot = mu
+    phase = beta
     table_object = table_FCC_A1_data
     #outputs =exodus
   [../]
   
+  #Interpolated susceptibility and mobility
+  #of the array kernels
+  [./diffusivity]
+    type = QuaternaryMultiPhaseDiffusivity
+    h_alpha = h_alpha
+    h_beta = h_beta
+  [../]
+  
 []
 
 [UserObjects]
@@ -602,6 +391,50 @@
   [../]
 []
 
+[AuxVariables]
+
+[./x_Al]
+  order = FIRST
+  family = LAGRANGE
+[../]
+
+[./x_Cr]
+  order = FIRST
+  family = LAGRANGE
+[../]
+
+[./x_Fe]
+  order = FIRST
+  family = LAGRANGE
+[../]
+[]
+
+[AuxKernels]
+  [./x_Al]
+    type = ArrayVariableComponent
+    variable = x_Al
+    array_variable = x
+    component = 0
+    execute_on = 'initial timestep_end'
+  [../]
+
+  [./x_Cr]
+    type = ArrayVariableComponent
+    variable = x_Cr
+    array_variable = x
+    component = 1
+    execute_on = 'initial timestep_end'
+  [../]
+
+  [./x_Fe]
+    type = ArrayVariableComponent
+    variable = x_Fe
+    array_variable = x
+    component = 2
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
 [Postprocessors]
 
   [./computation_time]